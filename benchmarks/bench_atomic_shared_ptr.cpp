@@ -0,0 +1,335 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2024, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <latch>
+#include <memory>
+#include <sh/atomic_shared_ptr.hpp>
+#include <sh/atomic_wide_shared_ptr.hpp>
+#include <sh/hazard_pointer.hpp>
+#include <thread>
+
+namespace
+{
+	/**	std::atomic<sh::shared_ptr>.
+	 */
+	struct sh_family final
+	{
+		static constexpr std::string_view name{ "atomic<sh::shared_ptr>" };
+		template <typename T> using shared_type = sh::shared_ptr<T>;
+		template <typename T> using atomic_type = std::atomic<sh::shared_ptr<T>>;
+
+		template <typename T>
+		static shared_type<T> make(const T& value)
+		{
+			return sh::make_shared<T>(value);
+		}
+		template <typename T>
+		static void read(const atomic_type<T>& shared)
+		{
+			const shared_type<T> loaded = shared.load();
+			bench::do_not_optimize(loaded);
+		}
+	};
+
+	/**	std::atomic<sh::shared_ptr> read via sh::pointer::hazard_domain::protect rather than load.
+	 */
+	struct sh_hazard_family final
+	{
+		static constexpr std::string_view name{ "atomic<sh::shared_ptr> protect" };
+		template <typename T> using shared_type = sh::shared_ptr<T>;
+		template <typename T> using atomic_type = std::atomic<sh::shared_ptr<T>>;
+
+		template <typename T>
+		static shared_type<T> make(const T& value)
+		{
+			return sh::make_shared<T>(value);
+		}
+		template <typename T>
+		static void read(const atomic_type<T>& shared)
+		{
+			const sh::hazard_guard<T> guard = sh::pointer::hazard_domain::global().protect(shared);
+			bench::do_not_optimize(*guard);
+		}
+	};
+
+	/**	std::atomic<sh::wide_shared_ptr>.
+	 */
+	struct sh_wide_family final
+	{
+		static constexpr std::string_view name{ "atomic<sh::wide_shared_ptr>" };
+		template <typename T> using shared_type = sh::wide_shared_ptr<T>;
+		template <typename T> using atomic_type = std::atomic<sh::wide_shared_ptr<T>>;
+
+		template <typename T>
+		static shared_type<T> make(const T& value)
+		{
+			return shared_type<T>{ sh::make_shared<T>(value) };
+		}
+		template <typename T>
+		static void read(const atomic_type<T>& shared)
+		{
+			const shared_type<T> loaded = shared.load();
+			bench::do_not_optimize(loaded);
+		}
+	};
+
+	/**	std::atomic<std::shared_ptr>.
+	 */
+	struct std_family final
+	{
+		static constexpr std::string_view name{ "atomic<std::shared_ptr>" };
+		template <typename T> using shared_type = std::shared_ptr<T>;
+		template <typename T> using atomic_type = std::atomic<std::shared_ptr<T>>;
+
+		template <typename T>
+		static shared_type<T> make(const T& value)
+		{
+			return std::make_shared<T>(value);
+		}
+		template <typename T>
+		static void read(const atomic_type<T>& shared)
+		{
+			const shared_type<T> loaded = shared.load();
+			bench::do_not_optimize(loaded);
+		}
+	};
+
+	/**	A read:write ratio. Writes rotate through store, exchange, and compare_exchange_strong.
+	 */
+	struct operation_mix final
+	{
+		std::string_view m_name;
+		/**	Out of every 100 operations, the number that are load.
+		 */
+		std::uint32_t m_reads_per_hundred;
+	};
+
+	constexpr operation_mix mixes[]{
+		{ "99:1", 99 },
+		{ "90:10", 90 },
+		{ "50:50", 50 },
+	};
+
+	/**	Only every latency_sample_period-th operation is individually timed to limit clock overhead.
+	 */
+	constexpr std::uint32_t latency_sample_period{ 16 };
+
+	/**	Return the sample at a given percentile.
+	 *	@param sorted_samples Samples sorted in ascending order.
+	 *	@param percentile The percentile in [0, 100].
+	 *	@return The sample at \p percentile or zero if there are no samples.
+	 */
+	double percentile_of(const std::vector<double>& sorted_samples, const double percentile)
+	{
+		if (sorted_samples.empty())
+		{
+			return 0.0;
+		}
+		const std::size_t index = std::min(
+			sorted_samples.size() - 1,
+			std::size_t(percentile / 100.0 * double(sorted_samples.size())));
+		return sorted_samples[index];
+	}
+
+	/**	A cheap per-thread pseudo random sequence used to interleave reads & writes.
+	 */
+	class xorshift final
+	{
+	public:
+		explicit xorshift(const std::uint32_t seed) noexcept
+			: m_state{ seed | 1u }
+		{ }
+		std::uint32_t operator()() noexcept
+		{
+			m_state ^= m_state << 13;
+			m_state ^= m_state >> 17;
+			m_state ^= m_state << 5;
+			return m_state;
+		}
+
+	private:
+		std::uint32_t m_state;
+	};
+
+	struct run_result final
+	{
+		double m_ops_per_second;
+		std::vector<double> m_latencies_ns;
+	};
+
+	template <typename Family>
+	run_result run_once(const std::size_t thread_count, const operation_mix& mix, const std::size_t ops_per_thread)
+	{
+		using value_type = std::uint64_t;
+		using shared_type = typename Family::template shared_type<value_type>;
+		using atomic_type = typename Family::template atomic_type<value_type>;
+
+		atomic_type shared{ Family::template make<value_type>(0) };
+		std::latch start{ std::ptrdiff_t(thread_count + 1) };
+		std::vector<std::vector<double>> latencies(thread_count);
+		std::vector<bench::stopwatch::clock::time_point> starts(thread_count);
+		std::vector<bench::stopwatch::clock::time_point> stops(thread_count);
+		std::vector<std::thread> threads;
+		threads.reserve(thread_count);
+
+		for (std::size_t thread_index = 0; thread_index < thread_count; ++thread_index)
+		{
+			threads.emplace_back([&, thread_index]()
+			{
+				const shared_type mine[2]{
+					Family::template make<value_type>(thread_index * 2),
+					Family::template make<value_type>(thread_index * 2 + 1)
+				};
+				std::vector<double>& samples = latencies[thread_index];
+				samples.reserve(ops_per_thread / latency_sample_period + 1);
+				xorshift random{ std::uint32_t(thread_index * 2654435761u) };
+				std::uint32_t write_index{ 0 };
+
+				const auto operate = [&](const std::uint32_t roll)
+				{
+					if (roll % 100u < mix.m_reads_per_hundred)
+					{
+						Family::template read<value_type>(shared);
+					}
+					else
+					{
+						const shared_type& desired = mine[write_index & 1u];
+						switch (write_index++ % 3u)
+						{
+						case 0:
+							shared.store(desired);
+							break;
+						case 1:
+						{
+							shared_type previous = shared.exchange(desired);
+							bench::do_not_optimize(previous);
+							break;
+						}
+						default:
+						{
+							shared_type expected = shared.load();
+							const bool exchanged = shared.compare_exchange_strong(expected, desired);
+							bench::do_not_optimize(exchanged);
+							break;
+						}
+						}
+					}
+				};
+
+				start.arrive_and_wait();
+				starts[thread_index] = bench::stopwatch::clock::now();
+				for (std::size_t op = 0; op < ops_per_thread; ++op)
+				{
+					const std::uint32_t roll = random();
+					if (op % latency_sample_period == 0)
+					{
+						const bench::stopwatch watch;
+						operate(roll);
+						samples.push_back(watch.elapsed_ns());
+					}
+					else
+					{
+						operate(roll);
+					}
+				}
+				stops[thread_index] = bench::stopwatch::clock::now();
+			});
+		}
+
+		start.arrive_and_wait();
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		// Measure from the first thread starting to the last thread stopping.
+		const double elapsed_ns = std::chrono::duration<double, std::nano>(
+			*std::max_element(stops.begin(), stops.end()) - *std::min_element(starts.begin(), starts.end())).count();
+
+		run_result result{ double(thread_count * ops_per_thread) / elapsed_ns * 1e9, {} };
+		for (std::vector<double>& samples : latencies)
+		{
+			result.m_latencies_ns.insert(result.m_latencies_ns.end(), samples.begin(), samples.end());
+		}
+		return result;
+	}
+
+	template <typename Family>
+	void run_family(const bench::options& opts, bench::table& table, const std::vector<std::size_t>& thread_counts)
+	{
+		const std::size_t ops_per_thread = opts.iterations(100000);
+		for (const operation_mix& mix : mixes)
+		{
+			for (const std::size_t thread_count : thread_counts)
+			{
+				std::vector<double> throughputs;
+				std::vector<double> latencies;
+				for (std::size_t trial = 0; trial < std::max<std::size_t>(opts.m_trials, 1); ++trial)
+				{
+					run_result result = run_once<Family>(thread_count, mix, ops_per_thread);
+					throughputs.push_back(result.m_ops_per_second);
+					latencies.insert(latencies.end(), result.m_latencies_ns.begin(), result.m_latencies_ns.end());
+				}
+				std::sort(latencies.begin(), latencies.end());
+				table.row({
+					std::string{ Family::name },
+					std::string{ mix.m_name },
+					bench::format(thread_count),
+					bench::format(bench::median(throughputs) / 1e6),
+					bench::format(percentile_of(latencies, 50.0), 0),
+					bench::format(percentile_of(latencies, 99.0), 0),
+					bench::format(percentile_of(latencies, 99.9), 0)
+				});
+			}
+		}
+	}
+} // anonymous namespace
+
+SH_BENCHMARK_SUITE(atomic_shared_ptr)
+{
+	bench::table table{ "std::atomic contention (load : store/exchange/compare_exchange)", {
+		{ "atomic", 32 },
+		{ "mix", 6 },
+		{ "threads", 7 },
+		{ "Mops/s", 9 },
+		{ "p50 ns", 8 },
+		{ "p99 ns", 8 },
+		{ "p999 ns", 8 }
+	} };
+	const std::vector<std::size_t> thread_counts = bench::sweep_thread_counts(opts);
+	run_family<sh_family>(opts, table, thread_counts);
+	run_family<sh_hazard_family>(opts, table, thread_counts);
+	run_family<sh_wide_family>(opts, table, thread_counts);
+	run_family<std_family>(opts, table, thread_counts);
+}
@@ -0,0 +1,142 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <map>
+#include <sh/deferred_shared.hpp>
+#include <sh/shared_ptr.hpp>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	/**	A value whose destruction frees many nodes.
+	 */
+	using tree_type = std::map<std::size_t, std::size_t>;
+
+	/**	Build a tree of a given number of nodes.
+	 */
+	tree_type make_tree(const std::size_t node_count)
+	{
+		tree_type tree;
+		for (std::size_t index = 0; index < node_count; ++index)
+		{
+			tree.emplace(index, index);
+		}
+		return tree;
+	}
+
+	/**	Values made via sh::make_shared & destroyed by the releasing thread.
+	 */
+	struct inline_mode final
+	{
+		static constexpr std::string_view name{ "sh::make_shared" };
+
+		static sh::shared_ptr<tree_type> make(tree_type&& tree)
+		{
+			return sh::make_shared<tree_type>(std::move(tree));
+		}
+		static void drain() noexcept
+		{ }
+	};
+
+	/**	Values made via sh::make_shared_deferred & destroyed by a background thread.
+	 */
+	struct deferred_mode final
+	{
+		static constexpr std::string_view name{ "sh::make_shared_deferred" };
+
+		static sh::shared_ptr<tree_type> make(tree_type&& tree)
+		{
+			return sh::make_shared_deferred<tree_type>(std::move(tree));
+		}
+		static void drain() noexcept
+		{
+			while (false == sh::deferred_reclaimer::global().empty())
+			{
+				std::this_thread::yield();
+			}
+		}
+	};
+
+	/**	Return the sample at a given fraction through sorted samples.
+	 */
+	double percentile(const std::vector<double>& sorted, const double fraction)
+	{
+		const std::size_t index = std::min(sorted.size() - 1, std::size_t(fraction * double(sorted.size())));
+		return sorted[index];
+	}
+
+	/**	Time the release of the last reference to each of a series of trees on the calling thread.
+	 */
+	template <typename Mode>
+	void run_mode(const bench::options& opts, bench::table& table, const std::size_t node_count)
+	{
+		const std::size_t releases = opts.iterations(200);
+		std::vector<double> samples;
+		samples.reserve(releases);
+		for (std::size_t index = 0; index < releases; ++index)
+		{
+			sh::shared_ptr<tree_type> value = Mode::make(make_tree(node_count));
+			const bench::stopwatch watch;
+			value.reset();
+			samples.push_back(watch.elapsed_ns());
+			// Don't let a backlog of deferred trees skew the next allocation.
+			Mode::drain();
+		}
+		std::sort(samples.begin(), samples.end());
+		table.row({
+			std::string{ Mode::name },
+			bench::format(node_count),
+			bench::format(percentile(samples, 0.5) / 1000.0),
+			bench::format(percentile(samples, 0.99) / 1000.0),
+			bench::format(samples.back() / 1000.0)
+		});
+	}
+} // anonymous namespace
+
+SH_BENCHMARK_SUITE(deferred_shared)
+{
+	bench::table table{ "Latency of releasing the last reference on the releasing thread", {
+		{ "mode", 26 },
+		{ "nodes", 8 },
+		{ "p50 us", 10 },
+		{ "p99 us", 10 },
+		{ "max us", 10 }
+	} };
+	for (const std::size_t node_count : { std::size_t{ 1 }, std::size_t{ 1000 }, std::size_t{ 100000 } })
+	{
+		run_mode<inline_mode>(opts, table, node_count);
+		run_mode<deferred_mode>(opts, table, node_count);
+	}
+}
@@ -0,0 +1,124 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "benchmark.hpp"
+
+#include <array>
+#include <cstdint>
+#include <sh/shared_ptr.hpp>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	/**	Trivially destructible base of distinct_value, through which values of every type are held.
+	 */
+	struct value_base
+	{
+		std::uint64_t m_value;
+	};
+	/**	A distinct trivially destructible type per Index, each of the same size & alignment.
+	 *	@tparam Index Distinguishes the type.
+	 */
+	template <std::size_t Index>
+	struct distinct_value final : value_base
+	{ };
+
+	using make_function = sh::shared_ptr<value_base>(*)(std::uint64_t);
+
+	/**	Return a function making values of each distinct_value type.
+	 *	@tparam Indices The indices of the types.
+	 *	@return The functions, one per index.
+	 */
+	template <std::size_t... Indices>
+	constexpr std::array<make_function, sizeof...(Indices)> make_functions(std::index_sequence<Indices...>) noexcept
+	{
+		return { {
+			[](const std::uint64_t value) -> sh::shared_ptr<value_base>
+			{
+				return sh::make_shared<distinct_value<Indices>>(distinct_value<Indices>{ { value } });
+			}...
+		} };
+	}
+
+	constexpr std::size_t max_type_count{ 256 };
+	constexpr std::array<make_function, max_type_count> makers{ make_functions(std::make_index_sequence<max_type_count>{}) };
+
+	/**	Make & release values round-robin across a number of distinct types.
+	 *	@param opts The benchmark options.
+	 *	@param table The table to which to report.
+	 *	@param type_count The number of distinct types among which to alternate.
+	 */
+	void run_types(const bench::options& opts, bench::table& table, const std::size_t type_count)
+	{
+		const std::size_t count = opts.iterations(1000000);
+		std::vector<sh::shared_ptr<value_base>> values;
+		values.reserve(count);
+
+		std::vector<double> make_samples;
+		const double ns_per_release = bench::run_trials(opts, [&]() -> double
+		{
+			const bench::stopwatch make_watch;
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				values.push_back(makers[index % type_count](index));
+			}
+			make_samples.push_back(make_watch.elapsed_ns() / double(count));
+
+			const bench::stopwatch release_watch;
+			values.clear();
+			return release_watch.elapsed_ns() / double(count);
+		});
+		const double ns_per_make = bench::median(make_samples);
+
+		table.row({
+			bench::format(type_count),
+			bench::format(count),
+			bench::format(ns_per_make),
+			bench::format(ns_per_release)
+		});
+	}
+} // anonymous namespace
+
+SH_BENCHMARK_SUITE(many_types)
+{
+	bench::table table{ SH_POINTER_SHARE_OPERATIONS
+		? "Make & release values of many distinct trivially destructible types"
+		: "Make & release values of many distinct trivially destructible types (!SH_POINTER_SHARE_OPERATIONS)", {
+		{ "types", 6 },
+		{ "values", 10 },
+		{ "ns/make", 8 },
+		{ "ns/release", 11 }
+	} };
+	run_types(opts, table, 1);
+	run_types(opts, table, 16);
+	run_types(opts, table, max_type_count);
+}
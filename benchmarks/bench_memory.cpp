@@ -0,0 +1,108 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <sh/shared_ptr.hpp>
+#include <vector>
+
+namespace
+{
+	/**	Allocate many small values & report the bytes each costs & the time to read them all back.
+	 *	@tparam Size The size of each value in bytes.
+	 *	@param opts The benchmark options.
+	 *	@param table The table to which to report.
+	 */
+	template <std::size_t Size>
+	void run_size(const bench::options& opts, bench::table& table)
+	{
+		using value_type = bench::payload<Size>;
+		const std::size_t count = opts.iterations(4000000);
+
+		std::vector<sh::shared_ptr<value_type>> values;
+		values.reserve(count);
+		const std::size_t bytes = bench::bytes_allocated_by([&]()
+		{
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				values.push_back(sh::allocate_shared<value_type>(bench::counting_allocator<value_type>{}));
+				values.back()->m_bytes[0] = static_cast<unsigned char>(index);
+			}
+			return values.size();
+		});
+
+		// Visit values in a fixed scattered order so that each read is likely to miss the cache of a smaller footprint.
+		std::vector<std::size_t> order(count);
+		std::iota(order.begin(), order.end(), std::size_t{ 0 });
+		std::shuffle(order.begin(), order.end(), std::minstd_rand{ 1 });
+		const double ns_per_read = bench::run_trials(opts, [&]() -> double
+		{
+			std::size_t sum{ 0 };
+			const bench::stopwatch watch;
+			for (const std::size_t index : order)
+			{
+				sum += values[index]->m_bytes[0];
+			}
+			const double elapsed_ns = watch.elapsed_ns();
+			bench::do_not_optimize(sum);
+			return elapsed_ns / double(count);
+		});
+
+		table.row({
+			bench::format(Size),
+			bench::format(count),
+			bench::format(sizeof(sh::pointer::convertible_control)),
+			bench::format(double(bytes) / double(count)),
+			bench::format(double(bytes) / double(1024 * 1024)),
+			bench::format(ns_per_read)
+		});
+	}
+} // anonymous namespace
+
+SH_BENCHMARK_SUITE(memory)
+{
+	bench::table table{ SH_POINTER_COMPACT_CONTROL
+		? "Memory of many small sh::shared_ptr values (SH_POINTER_COMPACT_CONTROL)"
+		: "Memory of many small sh::shared_ptr values", {
+		{ "value bytes", 12 },
+		{ "values", 10 },
+		{ "control bytes", 14 },
+		{ "bytes/value", 12 },
+		{ "total MiB", 10 },
+		{ "ns/read", 8 }
+	} };
+	run_size<1>(opts, table);
+	run_size<8>(opts, table);
+	run_size<24>(opts, table);
+}
@@ -0,0 +1,187 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2024, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <latch>
+#include <sh/atomic_shared_ptr.hpp>
+#include <sh/hazard_pointer.hpp>
+#include <sh/rcu.hpp>
+#include <thread>
+
+namespace
+{
+	using value_type = std::uint64_t;
+	using atomic_type = std::atomic<sh::shared_ptr<value_type>>;
+
+	/**	Reads within a single rcu_read_guard, amortizing its entry.
+	 */
+	constexpr std::size_t reads_per_section{ 16 };
+
+	/**	Read via load, copying a shared_ptr.
+	 */
+	struct load_reader final
+	{
+		static constexpr std::string_view name{ "load" };
+
+		static value_type read(const atomic_type& shared, const std::size_t count)
+		{
+			value_type sum{ 0 };
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				sum += *shared.load();
+			}
+			return sum;
+		}
+	};
+
+	/**	Read via hazard_domain::protect.
+	 */
+	struct hazard_reader final
+	{
+		static constexpr std::string_view name{ "hazard_domain::protect" };
+
+		static value_type read(const atomic_type& shared, const std::size_t count)
+		{
+			value_type sum{ 0 };
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				sum += *sh::pointer::hazard_domain::global().protect(shared);
+			}
+			return sum;
+		}
+	};
+
+	/**	Read via rcu_read_guard::load.
+	 */
+	struct rcu_reader final
+	{
+		static constexpr std::string_view name{ "rcu_read_guard::load" };
+
+		static value_type read(const atomic_type& shared, const std::size_t count)
+		{
+			value_type sum{ 0 };
+			for (std::size_t index = 0; index < count; index += reads_per_section)
+			{
+				const sh::rcu_read_guard guard;
+				for (std::size_t read = index; read < count && read < index + reads_per_section; ++read)
+				{
+					sum += *guard.load(shared);
+				}
+			}
+			return sum;
+		}
+	};
+
+	/**	Return reads per second across reader threads while a single writer periodically stores.
+	 */
+	template <typename Reader>
+	double run_once(const std::size_t thread_count, const std::size_t reads_per_thread)
+	{
+		atomic_type shared{ sh::make_shared<value_type>(0) };
+		std::latch start{ std::ptrdiff_t(thread_count + 1) };
+		std::atomic<std::size_t> running{ thread_count };
+		std::vector<std::thread> threads;
+		threads.reserve(thread_count + 1);
+
+		for (std::size_t thread_index = 0; thread_index < thread_count; ++thread_index)
+		{
+			threads.emplace_back([&]()
+			{
+				start.arrive_and_wait();
+				bench::do_not_optimize(Reader::read(shared, reads_per_thread));
+				running.fetch_sub(1, std::memory_order_release);
+			});
+		}
+		threads.emplace_back([&]()
+		{
+			value_type next{ 1 };
+			while (running.load(std::memory_order_acquire) != 0)
+			{
+				shared.store(sh::make_shared<value_type>(next++));
+				std::this_thread::sleep_for(std::chrono::microseconds{ 50 });
+			}
+		});
+
+		const bench::stopwatch watch;
+		start.arrive_and_wait();
+		for (std::size_t thread_index = 0; thread_index < thread_count; ++thread_index)
+		{
+			threads[thread_index].join();
+		}
+		const double elapsed_ns = watch.elapsed_ns();
+		threads.back().join();
+		return double(thread_count * reads_per_thread) / elapsed_ns * 1e9;
+	}
+
+	template <typename Reader>
+	void run_reader(const bench::options& opts, bench::table& table, const std::vector<std::size_t>& thread_counts)
+	{
+		const std::size_t reads_per_thread = opts.iterations(1000000);
+		double single_thread{ 0.0 };
+		for (const std::size_t thread_count : thread_counts)
+		{
+			std::vector<double> throughputs;
+			for (std::size_t trial = 0; trial < std::max<std::size_t>(opts.m_trials, 1); ++trial)
+			{
+				throughputs.push_back(run_once<Reader>(thread_count, reads_per_thread));
+			}
+			const double throughput = bench::median(throughputs);
+			if (thread_count == thread_counts.front())
+			{
+				single_thread = throughput;
+			}
+			table.row({
+				std::string{ Reader::name },
+				bench::format(thread_count),
+				bench::format(throughput / 1e6),
+				bench::format(single_thread > 0.0 ? throughput / single_thread : 0.0)
+			});
+		}
+	}
+} // anonymous namespace
+
+SH_BENCHMARK_SUITE(rcu)
+{
+	bench::table table{ "std::atomic<sh::shared_ptr> read scaling with one periodic writer", {
+		{ "read", 24 },
+		{ "threads", 7 },
+		{ "Mops/s", 9 },
+		{ "scaling", 8 }
+	} };
+	const std::vector<std::size_t> thread_counts = bench::sweep_thread_counts(opts);
+	run_reader<load_reader>(opts, table, thread_counts);
+	run_reader<hazard_reader>(opts, table, thread_counts);
+	run_reader<rcu_reader>(opts, table, thread_counts);
+}
@@ -0,0 +1,543 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2024, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <latch>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <sh/local_shared_ptr.hpp>
+#include <sh/pmr_shared_ptr.hpp>
+#include <sh/pool_allocator.hpp>
+#include <sh/recycled_shared.hpp>
+#include <sh/sharded_shared.hpp>
+#include <sh/shared_ptr.hpp>
+#include <sh/wide_shared_ptr.hpp>
+#include <thread>
+
+namespace
+{
+	/**	sh::shared_ptr & sh::weak_ptr.
+	 */
+	struct sh_family final
+	{
+		static constexpr std::string_view name{ "sh::shared_ptr" };
+		static constexpr bool has_collapse{ false };
+		static constexpr bool has_weak{ true };
+
+		template <typename T> using shared_type = sh::shared_ptr<T>;
+		template <typename T> using weak_type = sh::weak_ptr<T>;
+
+		template <typename T>
+		static shared_type<T> make()
+		{
+			return sh::make_shared<T>();
+		}
+		template <typename T, typename Alloc>
+		static shared_type<T> allocate(const Alloc& alloc)
+		{
+			return sh::allocate_shared<T>(alloc);
+		}
+	};
+
+	/**	A value wrapped to derive from sh::weak_free.
+	 */
+	template <typename T>
+	struct weak_free_value final : sh::weak_free
+	{
+		T m_value;
+	};
+
+	/**	sh::shared_ptr of weak-free values, without weak references.
+	 */
+	struct sh_weak_free_family final
+	{
+		static constexpr std::string_view name{ "sh::shared_ptr (weak-free)" };
+		static constexpr bool has_collapse{ false };
+		static constexpr bool has_weak{ false };
+
+		template <typename T> using shared_type = sh::shared_ptr<weak_free_value<T>>;
+
+		template <typename T>
+		static shared_type<T> make()
+		{
+			return sh::make_shared<weak_free_value<T>>();
+		}
+		template <typename T, typename Alloc>
+		static shared_type<T> allocate(const Alloc& alloc)
+		{
+			return sh::allocate_shared<weak_free_value<T>>(alloc);
+		}
+	};
+
+	/**	sh::shared_ptr & sh::weak_ptr, allocated via sh::make_pooled_shared.
+	 */
+	struct sh_pooled_family final
+	{
+		static constexpr std::string_view name{ "sh::shared_ptr (pool)" };
+		static constexpr bool has_collapse{ false };
+		static constexpr bool has_weak{ true };
+
+		template <typename T> using shared_type = sh::shared_ptr<T>;
+		template <typename T> using weak_type = sh::weak_ptr<T>;
+
+		template <typename T>
+		static shared_type<T> make()
+		{
+			return sh::make_pooled_shared<T>();
+		}
+		template <typename T, typename Alloc>
+		static shared_type<T> allocate(const Alloc& alloc)
+		{
+			return sh::allocate_shared<T>(alloc);
+		}
+	};
+
+	/**	sh::shared_ptr & sh::weak_ptr, allocated via sh::make_recycled_shared.
+	 */
+	struct sh_recycled_family final
+	{
+		static constexpr std::string_view name{ "sh::shared_ptr (recycle)" };
+		static constexpr bool has_collapse{ false };
+		static constexpr bool has_weak{ true };
+
+		template <typename T> using shared_type = sh::shared_ptr<T>;
+		template <typename T> using weak_type = sh::weak_ptr<T>;
+
+		template <typename T>
+		static shared_type<T> make()
+		{
+			return sh::make_recycled_shared<T>();
+		}
+		template <typename T, typename Alloc>
+		static shared_type<T> allocate(const Alloc& alloc)
+		{
+			return sh::allocate_shared<T>(alloc);
+		}
+	};
+
+	/**	sh::local_shared_ptr & sh::local_weak_ptr.
+	 */
+	struct sh_local_family final
+	{
+		static constexpr std::string_view name{ "sh::local_shared_ptr" };
+		static constexpr bool has_collapse{ false };
+		static constexpr bool has_weak{ true };
+
+		template <typename T> using shared_type = sh::local_shared_ptr<T>;
+		template <typename T> using weak_type = sh::local_weak_ptr<T>;
+
+		template <typename T>
+		static shared_type<T> make()
+		{
+			return sh::make_local_shared<T>();
+		}
+		template <typename T, typename Alloc>
+		static shared_type<T> allocate(const Alloc& alloc)
+		{
+			return sh::allocate_local_shared<T>(alloc);
+		}
+	};
+
+	/**	sh::wide_shared_ptr & sh::wide_weak_ptr, allocated via sh::make_shared.
+	 */
+	struct sh_wide_family final
+	{
+		static constexpr std::string_view name{ "sh::wide_shared_ptr" };
+		static constexpr bool has_collapse{ true };
+		static constexpr bool has_weak{ true };
+
+		template <typename T> using shared_type = sh::wide_shared_ptr<T>;
+		template <typename T> using weak_type = sh::wide_weak_ptr<T>;
+
+		template <typename T>
+		static shared_type<T> make()
+		{
+			return shared_type<T>{ sh::make_shared<T>() };
+		}
+		template <typename T, typename Alloc>
+		static shared_type<T> allocate(const Alloc& alloc)
+		{
+			return shared_type<T>{ sh::allocate_shared<T>(alloc) };
+		}
+	};
+
+	/**	std::shared_ptr & std::weak_ptr.
+	 */
+	struct std_family final
+	{
+		static constexpr std::string_view name{ "std::shared_ptr" };
+		static constexpr bool has_collapse{ false };
+		static constexpr bool has_weak{ true };
+
+		template <typename T> using shared_type = std::shared_ptr<T>;
+		template <typename T> using weak_type = std::weak_ptr<T>;
+
+		template <typename T>
+		static shared_type<T> make()
+		{
+			return std::make_shared<T>();
+		}
+		template <typename T, typename Alloc>
+		static shared_type<T> allocate(const Alloc& alloc)
+		{
+			return std::allocate_shared<T>(alloc);
+		}
+	};
+
+	/**	The number of pointers operated upon between stopwatch reads.
+	 */
+	constexpr std::size_t batch_size{ 1024 };
+
+	/**	Time batches of an operation and return the median ns/op across trials.
+	 *	@param opts The benchmark options.
+	 *	@param rounds The number of batches per trial.
+	 *	@param prepare Untimed setup before each batch.
+	 *	@param body The timed operation, given an index in [0, batch_size).
+	 *	@param cleanup Untimed teardown after each batch.
+	 *	@return The median ns/op.
+	 */
+	template <typename Prepare, typename Body, typename Cleanup>
+	double time_batches(const bench::options& opts, const std::size_t rounds, Prepare&& prepare, Body&& body, Cleanup&& cleanup)
+	{
+		return bench::run_trials(opts, [&]() -> double
+		{
+			double total_ns{ 0.0 };
+			for (std::size_t round = 0; round < rounds; ++round)
+			{
+				prepare();
+				const bench::stopwatch watch;
+				for (std::size_t index = 0; index < batch_size; ++index)
+				{
+					body(index);
+				}
+				total_ns += watch.elapsed_ns();
+				cleanup();
+			}
+			return total_ns / double(rounds * batch_size);
+		});
+	}
+
+	template <typename Family, std::size_t Size>
+	void run_family(const bench::options& opts, bench::table& table)
+	{
+		using value_type = bench::payload<Size>;
+		using shared_type = typename Family::template shared_type<value_type>;
+
+		const std::size_t rounds = opts.iterations(256);
+		const std::size_t bytes_per_object = sizeof(shared_type) + bench::bytes_allocated_by([]()
+		{
+			return Family::template allocate<value_type>(bench::counting_allocator<value_type>{});
+		});
+
+		std::vector<shared_type> slots(batch_size);
+		std::vector<shared_type> other_slots(batch_size);
+		const shared_type source = Family::template make<value_type>();
+
+		const auto nothing = []() noexcept {};
+		const auto fill_copies = [&]()
+		{
+			std::fill(slots.begin(), slots.end(), source);
+		};
+		const auto fill_unique = [&]()
+		{
+			for (shared_type& slot : slots)
+			{
+				slot = Family::template make<value_type>();
+			}
+		};
+		const auto clear = [&]()
+		{
+			for (shared_type& slot : slots)
+			{
+				slot.reset();
+			}
+			for (shared_type& slot : other_slots)
+			{
+				slot.reset();
+			}
+		};
+		const auto report = [&](const std::string_view case_name, const double ns_per_op, const bool show_bytes)
+		{
+			table.row({
+				std::string{ case_name },
+				std::string{ Family::name },
+				bench::format(Size),
+				bench::format(ns_per_op),
+				show_bytes ? bench::format(bytes_per_object) : std::string{ "-" }
+			});
+		};
+
+		report("make_shared", time_batches(opts, rounds, nothing,
+			[&](const std::size_t index) { slots[index] = Family::template make<value_type>(); },
+			clear), true);
+		report("allocate_shared", time_batches(opts, rounds, nothing,
+			[&](const std::size_t index) { slots[index] = Family::template allocate<value_type>(std::allocator<value_type>{}); },
+			clear), true);
+		report("destroy (last ref)", time_batches(opts, rounds, fill_unique,
+			[&](const std::size_t index) { slots[index].reset(); },
+			clear), false);
+		report("copy", time_batches(opts, rounds, nothing,
+			[&](const std::size_t index) { slots[index] = source; },
+			clear), false);
+		report("destroy (shared ref)", time_batches(opts, rounds, fill_copies,
+			[&](const std::size_t index) { slots[index].reset(); },
+			clear), false);
+		report("move", time_batches(opts, rounds, fill_copies,
+			[&](const std::size_t index) { other_slots[index] = std::move(slots[index]); },
+			clear), false);
+		if constexpr (Family::has_weak)
+		{
+			const typename Family::template weak_type<value_type> weak_source{ source };
+			report("weak_ptr::lock", time_batches(opts, rounds, nothing,
+				[&](const std::size_t index) { slots[index] = weak_source.lock(); },
+				clear), false);
+		}
+
+		if constexpr (Family::has_collapse)
+		{
+			std::vector<sh::shared_ptr<value_type>> collapsed(batch_size);
+			report("collapse", time_batches(opts, rounds, nothing,
+				[&](const std::size_t index) { collapsed[index] = source.collapse(); },
+				[&]() { std::fill(collapsed.begin(), collapsed.end(), nullptr); }), false);
+		}
+	}
+
+	/**	A std::pmr::memory_resource that counts bytes allocated via bench::allocated_bytes, used to report bytes/object.
+	 */
+	class counting_resource final : public std::pmr::memory_resource
+	{
+	private:
+		void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+		{
+			bench::allocated_bytes().fetch_add(bytes, std::memory_order_relaxed);
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+		void do_deallocate(void* const p, const std::size_t bytes, const std::size_t alignment) override
+		{
+			std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+		}
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			return this == &other;
+		}
+	};
+
+	/**	Time sh::pmr::allocate_shared & std::allocate_shared with a std::pmr::polymorphic_allocator for a given resource.
+	 *	@tparam Resource The std::pmr::memory_resource type, recreated before each batch.
+	 *	@tparam Size The size of the payload.
+	 *	@param opts The benchmark options.
+	 *	@param table The table to which to report.
+	 *	@param resource_name The name of Resource to report.
+	 */
+	template <typename Resource, std::size_t Size>
+	void run_pmr(const bench::options& opts, bench::table& table, const std::string_view resource_name)
+	{
+		using value_type = bench::payload<Size>;
+
+		const std::size_t rounds = opts.iterations(256);
+		std::optional<Resource> resource;
+		std::vector<sh::shared_ptr<value_type>> sh_slots(batch_size);
+		std::vector<std::shared_ptr<value_type>> std_slots(batch_size);
+
+		const auto prepare = [&]()
+		{
+			resource.emplace();
+		};
+		const auto fill_unique = [&]()
+		{
+			resource.emplace();
+			for (auto& slot : sh_slots)
+			{
+				slot = sh::pmr::allocate_shared<value_type>(&*resource);
+			}
+			for (auto& slot : std_slots)
+			{
+				slot = std::allocate_shared<value_type>(std::pmr::polymorphic_allocator<value_type>{ &*resource });
+			}
+		};
+		const auto clear = [&]()
+		{
+			std::fill(sh_slots.begin(), sh_slots.end(), nullptr);
+			std::fill(std_slots.begin(), std_slots.end(), nullptr);
+			resource.reset();
+		};
+
+		counting_resource counting;
+		const std::size_t sh_bytes = sizeof(sh::shared_ptr<value_type>) + bench::bytes_allocated_by([&]()
+		{
+			return sh::pmr::allocate_shared<value_type>(&counting);
+		});
+		const std::size_t std_bytes = sizeof(std::shared_ptr<value_type>) + bench::bytes_allocated_by([&]()
+		{
+			return std::allocate_shared<value_type>(std::pmr::polymorphic_allocator<value_type>{ &counting });
+		});
+		const auto report = [&](const std::string_view case_name, const std::string_view pointer_name, const double ns_per_op, const std::size_t bytes_per_object)
+		{
+			table.row({
+				std::string{ case_name },
+				std::string{ pointer_name },
+				std::string{ resource_name },
+				bench::format(Size),
+				bench::format(ns_per_op),
+				bench::format(bytes_per_object)
+			});
+		};
+
+		report("allocate_shared", "sh::shared_ptr", time_batches(opts, rounds, prepare,
+			[&](const std::size_t index) { sh_slots[index] = sh::pmr::allocate_shared<value_type>(&*resource); },
+			clear), sh_bytes);
+		report("allocate_shared", "std::shared_ptr", time_batches(opts, rounds, prepare,
+			[&](const std::size_t index) { std_slots[index] = std::allocate_shared<value_type>(std::pmr::polymorphic_allocator<value_type>{ &*resource }); },
+			clear), std_bytes);
+		report("destroy (last ref)", "sh::shared_ptr", time_batches(opts, rounds, fill_unique,
+			[&](const std::size_t index) { sh_slots[index].reset(); },
+			clear), sh_bytes);
+		report("destroy (last ref)", "std::shared_ptr", time_batches(opts, rounds, fill_unique,
+			[&](const std::size_t index) { std_slots[index].reset(); },
+			clear), std_bytes);
+	}
+
+	template <std::size_t Size>
+	void run_pmr_size(const bench::options& opts, bench::table& table)
+	{
+		run_pmr<std::pmr::monotonic_buffer_resource, Size>(opts, table, "monotonic");
+		run_pmr<std::pmr::unsynchronized_pool_resource, Size>(opts, table, "unsync pool");
+	}
+
+	/**	Time threads concurrently copying & releasing references to one shared constant.
+	 *	@param opts The benchmark options.
+	 *	@param table The table to which to report.
+	 *	@param pointer_name The name of the pointer to report.
+	 *	@param source The shared constant.
+	 *	@param thread_counts The thread counts to sweep.
+	 */
+	template <typename Shared>
+	void run_constant(const bench::options& opts, bench::table& table, const std::string_view pointer_name, const Shared& source, const std::vector<std::size_t>& thread_counts)
+	{
+		const std::size_t ops_per_thread = opts.iterations(1000000);
+		for (const std::size_t thread_count : thread_counts)
+		{
+			const double ns_per_op = bench::run_trials(opts, [&]() -> double
+			{
+				std::latch start{ std::ptrdiff_t(thread_count + 1) };
+				std::vector<bench::stopwatch::clock::time_point> starts(thread_count);
+				std::vector<bench::stopwatch::clock::time_point> stops(thread_count);
+				std::vector<std::thread> threads;
+				threads.reserve(thread_count);
+				for (std::size_t thread_index = 0; thread_index < thread_count; ++thread_index)
+				{
+					threads.emplace_back([&, thread_index]()
+					{
+						start.arrive_and_wait();
+						starts[thread_index] = bench::stopwatch::clock::now();
+						for (std::size_t op = 0; op < ops_per_thread; ++op)
+						{
+							Shared copy = source;
+							bench::do_not_optimize(copy);
+						}
+						stops[thread_index] = bench::stopwatch::clock::now();
+					});
+				}
+				start.arrive_and_wait();
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+				// Measure from the first thread starting to the last thread stopping.
+				const double elapsed_ns = std::chrono::duration<double, std::nano>(
+					*std::max_element(stops.begin(), stops.end()) - *std::min_element(starts.begin(), starts.end())).count();
+				return elapsed_ns / double(thread_count * ops_per_thread);
+			});
+			table.row({
+				std::string{ pointer_name },
+				bench::format(thread_count),
+				bench::format(ns_per_op)
+			});
+		}
+	}
+
+	template <std::size_t Size>
+	void run_size(const bench::options& opts, bench::table& table)
+	{
+		run_family<sh_family, Size>(opts, table);
+		run_family<sh_weak_free_family, Size>(opts, table);
+		run_family<sh_pooled_family, Size>(opts, table);
+		run_family<sh_recycled_family, Size>(opts, table);
+		run_family<sh_local_family, Size>(opts, table);
+		run_family<sh_wide_family, Size>(opts, table);
+		run_family<std_family, Size>(opts, table);
+	}
+} // anonymous namespace
+
+SH_BENCHMARK_SUITE(shared_ptr)
+{
+	bench::table table{ "sh::shared_ptr vs std::shared_ptr (single thread)", {
+		{ "case", 22 },
+		{ "pointer", 27 },
+		{ "size", 6 },
+		{ "ns/op", 10 },
+		{ "bytes/object", 12 }
+	} };
+	run_size<8>(opts, table);
+	run_size<64>(opts, table);
+	run_size<256>(opts, table);
+
+	bench::table pmr_table{ "sh::pmr::allocate_shared vs std::allocate_shared (std::pmr, single thread)", {
+		{ "case", 22 },
+		{ "pointer", 22 },
+		{ "resource", 12 },
+		{ "size", 6 },
+		{ "ns/op", 10 },
+		{ "bytes/object", 12 }
+	} };
+	run_pmr_size<8>(opts, pmr_table);
+	run_pmr_size<64>(opts, pmr_table);
+	run_pmr_size<256>(opts, pmr_table);
+
+	bench::table constant_table{ "Copy & release of a shared constant (ns/op across all threads)", {
+		{ "pointer", 28 },
+		{ "threads", 7 },
+		{ "ns/op", 10 }
+	} };
+	const std::vector<std::size_t> thread_counts = bench::sweep_thread_counts(opts);
+	using constant_type = bench::payload<64>;
+	run_constant(opts, constant_table, "sh::shared_ptr", sh::make_shared<constant_type>(), thread_counts);
+#if SH_POINTER_SPECIAL_COUNT
+	// Immortal allocations are never freed, so make only one:
+	static const sh::shared_ptr<constant_type> immortal = sh::make_immortal_shared<constant_type>();
+	run_constant(opts, constant_table, "sh::shared_ptr (immortal)", immortal, thread_counts);
+	run_constant(opts, constant_table, "sh::shared_ptr (sharded)", sh::make_sharded_shared<constant_type>(), thread_counts);
+#endif // SH_POINTER_SPECIAL_COUNT
+	run_constant(opts, constant_table, "std::shared_ptr", std::make_shared<constant_type>(), thread_counts);
+}
@@ -0,0 +1,364 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2024, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__BENCHMARKS__BENCHMARK_HPP
+#define INC_SH__BENCHMARKS__BENCHMARK_HPP
+
+/**	@file
+ *	A small, dependency free benchmarking harness used by run-benchmarks.
+ *
+ *	Suites register themselves via SH_BENCHMARK_SUITE and print their results
+ *	as plain text tables through bench::table. Each measurement is repeated
+ *	bench::options::trials times and the median is reported.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+	/**	Command line controlled options shared by all suites.
+	 */
+	struct options final
+	{
+		/**	Multiplier applied to each suite's iteration counts.
+		 */
+		double m_scale{ 1.0 };
+		/**	Number of times each measurement is repeated. The median is reported.
+		 */
+		std::size_t m_trials{ 5 };
+		/**	Upper bound on thread counts used by multithreaded suites. Zero uses std::thread::hardware_concurrency.
+		 */
+		std::size_t m_max_threads{ 0 };
+
+		/**	Scale a suite's base iteration count by m_scale.
+		 *	@param base The iteration count at a scale of 1.
+		 *	@return The scaled iteration count, never less than 1.
+		 */
+		std::size_t iterations(const std::size_t base) const noexcept
+		{
+			const double scaled = double(base) * m_scale;
+			return scaled < 1.0 ? std::size_t{ 1 } : std::size_t(scaled);
+		}
+	};
+
+	/**	Return the thread counts for multithreaded suites to sweep: powers of two up to and including the maximum.
+	 *	@param opts The benchmark options.
+	 *	@return The thread counts.
+	 */
+	inline std::vector<std::size_t> sweep_thread_counts(const options& opts)
+	{
+		const std::size_t max_threads = opts.m_max_threads != 0
+			? opts.m_max_threads
+			: std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+		std::vector<std::size_t> thread_counts;
+		for (std::size_t count = 1; count < max_threads; count *= 2)
+		{
+			thread_counts.push_back(count);
+		}
+		thread_counts.push_back(max_threads);
+		return thread_counts;
+	}
+
+	/**	Prevent the compiler from optimizing away a value or the computation that produced it.
+	 *	@param value The value to consider observed.
+	 */
+	template <typename T>
+	inline void do_not_optimize(const T& value) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		static const void* volatile sink;
+		sink = std::addressof(value);
+#else // !_MSC_VER || __clang__
+		asm volatile("" : : "g"(std::addressof(value)) : "memory");
+#endif // !_MSC_VER || __clang__
+	}
+
+	/**	Measures elapsed wall clock time with std::chrono::steady_clock.
+	 */
+	class stopwatch final
+	{
+	public:
+		using clock = std::chrono::steady_clock;
+
+		stopwatch() noexcept
+			: m_start{ clock::now() }
+		{ }
+
+		/**	Return the nanoseconds elapsed since construction or the last restart.
+		 *	@return Elapsed nanoseconds.
+		 */
+		double elapsed_ns() const noexcept
+		{
+			return std::chrono::duration<double, std::nano>(clock::now() - m_start).count();
+		}
+		/**	Restart the stopwatch.
+		 */
+		void restart() noexcept
+		{
+			m_start = clock::now();
+		}
+
+	private:
+		clock::time_point m_start;
+	};
+
+	/**	Return the median of a set of samples.
+	 *	@param samples The samples, which will be reordered.
+	 *	@return The median sample or zero if empty.
+	 */
+	inline double median(std::vector<double>& samples)
+	{
+		if (samples.empty())
+		{
+			return 0.0;
+		}
+		const auto middle = samples.begin() + std::ptrdiff_t(samples.size() / 2);
+		std::nth_element(samples.begin(), middle, samples.end());
+		return *middle;
+	}
+
+	/**	Run a trial function a number of times and return the median result.
+	 *	@param opts The options controlling the number of trials.
+	 *	@param trial A callable returning a measurement (typically ns/op).
+	 *	@return The median measurement.
+	 */
+	template <typename Trial>
+	double run_trials(const options& opts, Trial&& trial)
+	{
+		std::vector<double> samples;
+		samples.reserve(opts.m_trials);
+		for (std::size_t index = 0; index < std::max<std::size_t>(opts.m_trials, 1); ++index)
+		{
+			samples.push_back(trial());
+		}
+		return median(samples);
+	}
+
+	/**	Format a floating point value with a fixed number of decimal places.
+	 *	@param value The value to format.
+	 *	@param precision The number of decimal places.
+	 *	@return The formatted value.
+	 */
+	inline std::string format(const double value, const int precision = 2)
+	{
+		char buffer[64];
+		std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+		return buffer;
+	}
+	/**	Format an unsigned integral value.
+	 *	@param value The value to format.
+	 *	@return The formatted value.
+	 */
+	inline std::string format(const std::size_t value)
+	{
+		return std::to_string(value);
+	}
+
+	/**	A plain text table written to stdout a row at a time.
+	 */
+	class table final
+	{
+	public:
+		/**	A column heading & width.
+		 */
+		struct column final
+		{
+			std::string_view m_name;
+			int m_width;
+		};
+
+		/**	Print a title and column headings.
+		 *	@param title The table's title.
+		 *	@param columns The column headings. The first column is left aligned, others are right aligned.
+		 */
+		table(const std::string_view title, std::initializer_list<column> columns)
+			: m_columns{ columns }
+		{
+			std::printf("\n%.*s\n", int(title.size()), title.data());
+			std::string line;
+			for (std::size_t index = 0; index < m_columns.size(); ++index)
+			{
+				append(line, index, m_columns[index].m_name);
+			}
+			std::printf("%s\n%s\n", line.c_str(), std::string(line.size(), '-').c_str());
+		}
+
+		/**	Print a row of cells. Missing cells are left blank.
+		 *	@param cells The cells of the row.
+		 */
+		void row(std::initializer_list<std::string> cells)
+		{
+			std::string line;
+			std::size_t index = 0;
+			for (const std::string& cell : cells)
+			{
+				if (index < m_columns.size())
+				{
+					append(line, index++, cell);
+				}
+			}
+			std::printf("%s\n", line.c_str());
+			std::fflush(stdout);
+		}
+
+	private:
+		void append(std::string& line, const std::size_t index, const std::string_view text) const
+		{
+			const std::size_t width = std::size_t(std::max(m_columns[index].m_width, 1));
+			const std::size_t padding = text.size() < width ? width - text.size() : 0;
+			if (index > 0)
+			{
+				line.append(1, ' ');
+				line.append(padding, ' ');
+				line.append(text);
+			}
+			else
+			{
+				line.append(text);
+				line.append(padding, ' ');
+			}
+		}
+
+		std::vector<column> m_columns;
+	};
+
+	/**	Counts bytes allocated through counting_allocator, used to report bytes/object.
+	 */
+	inline std::atomic<std::size_t>& allocated_bytes() noexcept
+	{
+		static std::atomic<std::size_t> instance{ 0 };
+		return instance;
+	}
+
+	/**	A stateless allocator forwarding to std::allocator that tallies allocated bytes.
+	 *	@tparam T The value type.
+	 */
+	template <typename T>
+	struct counting_allocator final
+	{
+		using value_type = T;
+
+		counting_allocator() noexcept = default;
+		template <typename U>
+		constexpr counting_allocator(const counting_allocator<U>&) noexcept
+		{ }
+
+		[[nodiscard]] T* allocate(const std::size_t n)
+		{
+			allocated_bytes().fetch_add(n * sizeof(T), std::memory_order_relaxed);
+			return std::allocator<T>{}.allocate(n);
+		}
+		void deallocate(T* const p, const std::size_t n) noexcept
+		{
+			std::allocator<T>{}.deallocate(p, n);
+		}
+
+		template <typename U>
+		constexpr bool operator==(const counting_allocator<U>&) const noexcept
+		{
+			return true;
+		}
+	};
+
+	/**	Return the number of bytes allocated by a callable via counting_allocator.
+	 *	@param allocate A callable that allocates via counting_allocator and returns the result.
+	 *	@return The number of bytes allocated while invoking \p allocate.
+	 */
+	template <typename Allocate>
+	std::size_t bytes_allocated_by(Allocate&& allocate)
+	{
+		const std::size_t before = allocated_bytes().load();
+		auto result = allocate();
+		do_not_optimize(result);
+		return allocated_bytes().load() - before;
+	}
+
+	/**	A trivially copyable payload of a given size.
+	 *	@tparam Size The size of the payload in bytes.
+	 */
+	template <std::size_t Size>
+	struct payload final
+	{
+		unsigned char m_bytes[Size];
+	};
+
+	/**	A registered benchmark suite.
+	 */
+	struct suite final
+	{
+		using function_type = void(*)(const options&);
+
+		const char* m_name;
+		function_type m_function;
+	};
+
+	/**	Return the registry of benchmark suites.
+	 *	@return A reference to the static registry.
+	 */
+	inline std::vector<suite>& suites()
+	{
+		static std::vector<suite> instance;
+		return instance;
+	}
+
+	/**	Registers a suite during static initialization.
+	 */
+	struct register_suite final
+	{
+		register_suite(const char* const name, const suite::function_type function)
+		{
+			suites().push_back(suite{ name, function });
+		}
+	};
+
+} // namespace bench
+
+/**	Define & register a benchmark suite function taking a `const bench::options& opts` parameter.
+ */
+#define SH_BENCHMARK_SUITE(NAME) \
+	static void sh_benchmark_suite_##NAME(const ::bench::options& opts); \
+	static const ::bench::register_suite sh_benchmark_register_##NAME{ #NAME, &sh_benchmark_suite_##NAME }; \
+	static void sh_benchmark_suite_##NAME(const ::bench::options& opts)
+
+#endif
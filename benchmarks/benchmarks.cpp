@@ -0,0 +1,132 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2024, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+	void print_usage(const char* const program)
+	{
+		std::printf(
+			"Usage: %s [options] [suite filter...]\n"
+			"  --scale=N        Multiply iteration counts by N (default 1).\n"
+			"  --trials=N       Repeat each measurement N times and report the median (default 5).\n"
+			"  --max-threads=N  Limit multithreaded suites to N threads (default hardware concurrency).\n"
+			"  --list           List suites and exit.\n"
+			"Suites whose names contain any filter are run; with no filters, all suites run.\n",
+			program);
+	}
+
+	bool parse_option(const std::string_view arg, const std::string_view name, std::string_view& value)
+	{
+		if (arg.substr(0, name.size()) == name && arg.size() > name.size() && arg[name.size()] == '=')
+		{
+			value = arg.substr(name.size() + 1);
+			return true;
+		}
+		return false;
+	}
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+	bench::options opts;
+	std::vector<std::string_view> filters;
+	bool list_only = false;
+
+	for (int index = 1; index < argc; ++index)
+	{
+		const std::string_view arg{ argv[index] };
+		std::string_view value;
+		if (parse_option(arg, "--scale", value))
+		{
+			opts.m_scale = std::strtod(std::string{ value }.c_str(), nullptr);
+		}
+		else if (parse_option(arg, "--trials", value))
+		{
+			opts.m_trials = std::strtoul(std::string{ value }.c_str(), nullptr, 10);
+		}
+		else if (parse_option(arg, "--max-threads", value))
+		{
+			opts.m_max_threads = std::strtoul(std::string{ value }.c_str(), nullptr, 10);
+		}
+		else if (arg == "--list")
+		{
+			list_only = true;
+		}
+		else if (arg == "--help" || arg == "-h" || arg.substr(0, 2) == "--")
+		{
+			print_usage(argv[0]);
+			return arg == "--help" || arg == "-h" ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+		else
+		{
+			filters.push_back(arg);
+		}
+	}
+
+	// Some standard libraries (e.g., libstdc++ via __libc_single_threaded)
+	// skip atomic reference counting in std::shared_ptr until a second
+	// thread has been started. Start one so comparisons are like-for-like.
+	std::thread{ []() noexcept {} }.join();
+
+#if !defined(NDEBUG)
+	std::printf("Warning: built without NDEBUG; debug validation makes these numbers unrepresentative.\n");
+#endif // !NDEBUG
+
+	for (const bench::suite& suite : bench::suites())
+	{
+		const std::string_view name{ suite.m_name };
+		const bool selected = filters.empty()
+			|| std::any_of(filters.begin(), filters.end(), [&name](const std::string_view filter)
+			{
+				return name.find(filter) != std::string_view::npos;
+			});
+		if (selected == false)
+		{
+			continue;
+		}
+		if (list_only)
+		{
+			std::printf("%s\n", suite.m_name);
+		}
+		else
+		{
+			suite.m_function(opts);
+		}
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+# Compare the time taken to compile build_time.cpp using sh headers alone, with SH_POINTER_EXTERN_TEMPLATES (linking
+# the sh-pointer library), & importing the experimental sh.pointer module. Run via the run-build-benchmark target or
+# as:
+#
+#	cmake -DCXX=<compiler> -DSOURCE_DIR=<repository> -DBINARY_DIR=<scratch directory>
+#		[-DMODULE_FLAGS=<flags compiling modules>] [-DTRIALS=<compiles per measurement>] -P build_time.cmake
+#
+# Each measurement is the median of TRIALS compiles. The one-time column is the time to compile sh/instantiations.cpp
+# or sh/pointer.cppm, which is paid once per build rather than per translation unit.
+cmake_minimum_required(VERSION 3.23)
+
+if(NOT DEFINED TRIALS)
+	set(TRIALS 5)
+endif()
+file(MAKE_DIRECTORY "${BINARY_DIR}")
+
+# Set result to the median milliseconds taken by TRIALS runs of the command given as the remaining arguments.
+function(median_ms result)
+	set(samples "")
+	foreach(trial RANGE 1 ${TRIALS})
+		string(TIMESTAMP start "%s%f" UTC)
+		execute_process(
+			COMMAND ${ARGN}
+			WORKING_DIRECTORY "${BINARY_DIR}"
+			RESULT_VARIABLE status
+			ERROR_VARIABLE errors
+			OUTPUT_QUIET
+		)
+		string(TIMESTAMP stop "%s%f" UTC)
+		if(NOT status EQUAL 0)
+			message(FATAL_ERROR "Failed to compile:\n${errors}")
+		endif()
+		math(EXPR elapsed "(${stop} - ${start}) / 1000")
+		list(APPEND samples ${elapsed})
+	endforeach()
+	list(SORT samples COMPARE NATURAL)
+	math(EXPR middle "${TRIALS} / 2")
+	list(GET samples ${middle} median)
+	set(${result} ${median} PARENT_SCOPE)
+endfunction()
+
+# Print a row of cells, the first left aligned & the others right aligned to the given widths.
+function(print_row)
+	set(widths 16 14 14 10)
+	set(line "")
+	set(index 0)
+	foreach(cell IN LISTS ARGN)
+		list(GET widths ${index} width)
+		string(LENGTH "${cell}" length)
+		math(EXPR padding "${width} - ${length}")
+		if(padding LESS 0)
+			set(padding 0)
+		endif()
+		string(REPEAT " " ${padding} spaces)
+		if(index EQUAL 0)
+			string(APPEND line "${cell}${spaces}")
+		else()
+			string(APPEND line " ${spaces}${cell}")
+		endif()
+		math(EXPR index "${index} + 1")
+	endforeach()
+	message("${line}")
+endfunction()
+
+set(source "${SOURCE_DIR}/benchmarks/build_time.cpp")
+set(common -std=c++20 "-I${SOURCE_DIR}" -c)
+
+message("\nBuild time of benchmarks/build_time.cpp (median of ${TRIALS} compiles)")
+print_row("build" "flags" "one-time ms" "ms/TU")
+message("---------------------------------------------------------")
+foreach(flags "-O0" "-O2;-DNDEBUG")
+	string(REPLACE ";" " " flags_text "${flags}")
+
+	median_ms(header_ms "${CXX}" ${common} ${flags} "${source}" -o header.o)
+	print_row("header-only" "${flags_text}" "" "${header_ms}")
+
+	median_ms(library_ms "${CXX}" ${common} ${flags} -DSH_POINTER_EXTERN_TEMPLATES=1
+		"${SOURCE_DIR}/sh/instantiations.cpp" -o instantiations.o)
+	median_ms(extern_ms "${CXX}" ${common} ${flags} -DSH_POINTER_EXTERN_TEMPLATES=1 "${source}" -o extern.o)
+	print_row("extern templates" "${flags_text}" "${library_ms}" "${extern_ms}")
+
+	if(MODULE_FLAGS)
+		median_ms(module_ms "${CXX}" ${common} ${flags} ${MODULE_FLAGS} -x c++
+			"${SOURCE_DIR}/sh/pointer.cppm" -o pointer.o)
+		median_ms(import_ms "${CXX}" ${common} ${flags} ${MODULE_FLAGS} -DSH_POINTER_BUILD_TIME_MODULE=1
+			"${source}" -o import.o)
+		print_row("module" "${flags_text}" "${module_ms}" "${import_ms}")
+	endif()
+endforeach()
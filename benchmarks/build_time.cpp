@@ -0,0 +1,117 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**	@file
+ *	A translation unit compiled, but not linked, by build_time.cmake to compare the time taken to compile code using
+ *	sh headers, with & without SH_POINTER_EXTERN_TEMPLATES, against that importing the sh.pointer module.
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#if SH_POINTER_BUILD_TIME_MODULE
+	// GCC 12 requires these be visible to instantiate imported templates:
+	#include <memory>
+	#include <new>
+	#include <typeinfo>
+import sh.pointer;
+#else // !SH_POINTER_BUILD_TIME_MODULE
+	#include <sh/shared_ptr.hpp>
+	#include <sh/wide_shared_ptr.hpp>
+#endif // !SH_POINTER_BUILD_TIME_MODULE
+
+namespace build_time
+{
+	/**	A byte buffer shared among readers, as is typical of I/O code.
+	 */
+	struct buffer final
+	{
+		sh::shared_ptr<char[]> m_chars;
+		sh::shared_ptr<std::byte[]> m_bytes;
+		std::size_t m_size;
+	};
+
+	buffer make_buffer(const std::size_t size)
+	{
+		return buffer{
+			sh::make_shared<char[]>(size),
+			sh::make_shared_for_overwrite<std::byte[]>(size),
+			size
+		};
+	}
+	buffer make_filled_buffer(const std::size_t size, const char fill)
+	{
+		return buffer{
+			sh::make_shared<char[]>(size, fill),
+			sh::make_shared<std::byte[]>(size, std::byte{ 0 }),
+			size
+		};
+	}
+	buffer copy_buffer(const buffer& other)
+	{
+		buffer copy = make_buffer(other.m_size);
+		std::memcpy(copy.m_chars.get(), other.m_chars.get(), other.m_size);
+		std::memcpy(copy.m_bytes.get(), other.m_bytes.get(), other.m_size);
+		return copy;
+	}
+	sh::weak_ptr<char[]> observe(const buffer& value)
+	{
+		return value.m_chars;
+	}
+	sh::shared_ptr<char[]> lock(const sh::weak_ptr<char[]>& value)
+	{
+		return value.lock();
+	}
+	sh::wide_shared_ptr<char[]> adopt(char* const chars)
+	{
+		return sh::wide_shared_ptr<char[]>{ chars };
+	}
+	sh::wide_shared_ptr<std::byte[]> adopt(std::byte* const bytes)
+	{
+		return sh::wide_shared_ptr<std::byte[]>{ bytes };
+	}
+	bool same_owner(const buffer& lhs, const buffer& rhs)
+	{
+		return false == lhs.m_chars.owner_before(rhs.m_chars)
+			&& false == rhs.m_chars.owner_before(lhs.m_chars);
+	}
+	void swap(buffer& lhs, buffer& rhs) noexcept
+	{
+		lhs.m_chars.swap(rhs.m_chars);
+		lhs.m_bytes.swap(rhs.m_bytes);
+		std::swap(lhs.m_size, rhs.m_size);
+	}
+	long use_count(const buffer& value)
+	{
+		return long(value.m_chars.use_count()) + long(value.m_bytes.use_count());
+	}
+} // namespace build_time
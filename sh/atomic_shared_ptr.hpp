@@ -33,6 +33,7 @@
 #define INC_SH__ATOMIC_SHARED_PTR_HPP
 
 #include <atomic>
+#include <climits>
 #include <cstdint>
 #include <thread>
 
@@ -44,8 +45,95 @@
 
 #include "shared_ptr.hpp"
 
+/**	The number of most significant bits of a user space pointer known to be zero, used by std::atomic<sh::shared_ptr>
+ *	and std::atomic<sh::weak_ptr> to hold a count of loads in progress. If zero, the bits left zero by the alignment
+ *	of sh::pointer::convertible_control are used instead, which allows fewer loads to proceed simultaneously & requires
+ *	compare-and-exchange rather than fetch_add to borrow.
+ *	@note x86-64 user space addresses fit within 47 bits unless 5-level paging is both available & explicitly
+ *		requested of the operating system. Other architectures may tag the most significant bits of pointers (e.g.,
+ *		AArch64 top-byte-ignore), so they default to zero.
+ */
+#if !defined(SH_POINTER_ATOMIC_HIGH_BITS)
+	#if (defined(__x86_64__) || defined(_M_X64)) && UINTPTR_MAX == 0xFFFF'FFFF'FFFF'FFFFu
+		#define SH_POINTER_ATOMIC_HIGH_BITS 16
+	#else
+		#define SH_POINTER_ATOMIC_HIGH_BITS 0
+	#endif
+#endif // SH_POINTER_ATOMIC_HIGH_BITS
+
+namespace sh
+{
+	class rcu_read_guard;
+} // namespace sh
+
 namespace sh::pointer
 {
+	class hazard_domain;
+
+	/**	Hooks of domains that borrow values from std::atomic<sh::shared_ptr> without counting references (i.e.,
+	 *	sh::pointer::hazard_domain & sh::pointer::rcu_domain), consulted by writers replacing control blocks.
+	 *	@detail Each domain installs its hook before its first borrow, so writers in programs that never borrow load
+	 *		one empty slot rather than consulting every domain. Replacement is a sequentially consistent
+	 *		read-modify-write & the slots are loaded sequentially consistent after it, so a writer that finds no hook
+	 *		installed replaced its control block before any borrow could have found it.
+	 */
+	class replaced_hooks final
+	{
+	public:
+		/**	A hook retaining a replaced control block, deferring the release of one more reference to it if a borrow
+		 *	may still refer to it.
+		 */
+		using retain_function = void (*)(control*) noexcept;
+
+		replaced_hooks() = delete;
+
+		/**	Install a hook if it isn't already, to be called upon replacement of every control block hereafter.
+		 *	@param hook The hook to install.
+		 */
+		static void install(const retain_function hook) noexcept
+		{
+			for (std::atomic<retain_function>& slot : slots())
+			{
+				retain_function expected = slot.load(std::memory_order_seq_cst);
+				if (expected == nullptr && slot.compare_exchange_strong(expected, hook, std::memory_order_seq_cst))
+				{
+					return;
+				}
+				if (expected == hook)
+				{
+					return;
+				}
+			}
+			SH_POINTER_ASSERT(false, "Didn't expect more domains than replaced_hooks has slots.");
+		}
+		/**	Call each installed hook upon a replaced control block.
+		 *	@param ctrl The non-null control block that was replaced.
+		 */
+		static void retain(control* const ctrl) noexcept
+		{
+			for (std::atomic<retain_function>& slot : slots())
+			{
+				const retain_function hook = slot.load(std::memory_order_seq_cst);
+				if (hook == nullptr)
+				{
+					return;
+				}
+				hook(ctrl);
+			}
+		}
+
+	private:
+		/**	The number of domains that may install hooks.
+		 */
+		static constexpr std::size_t capacity{ 2 };
+
+		static std::atomic<retain_function> (&slots() noexcept)[capacity]
+		{
+			static std::atomic<retain_function> instance[capacity]{};
+			return instance;
+		}
+	};
+
 	/**	Encapsulation of a very simple wait mechanism for use in spin lock-style loops.
 	 */
 	class atomic_control_spin_waiter final
@@ -101,6 +189,39 @@ namespace sh::pointer
 				ctrl->shared_dec();
 			}
 		}
+		static void increment(control* const ctrl, const use_count_t count) noexcept
+		{
+			if (ctrl && count > 0)
+			{
+				ctrl->shared_inc(count);
+			}
+		}
+		static void decrement(control* const ctrl, const use_count_t count) noexcept
+		{
+			if (ctrl && count > 0)
+			{
+				ctrl->shared_dec(count);
+			}
+		}
+		/**	Release references to a control block replaced within an atomic, deferring one each if it's protected by a hazard_guard or rcu_read_guard.
+		 */
+		static void release_replaced(control* const ctrl, const use_count_t count) noexcept
+		{
+			if (ctrl && count > 0)
+			{
+				replaced_hooks::retain(ctrl);
+				decrement(ctrl, count);
+			}
+		}
+		/**	Retain a control block replaced within an atomic & handed to the caller, deferring one reference each if it's protected by a hazard_guard or rcu_read_guard.
+		 */
+		static void retain_replaced(control* const ctrl) noexcept
+		{
+			if (ctrl)
+			{
+				replaced_hooks::retain(ctrl);
+			}
+		}
 	};
 
 	/**	Namespace-like type to pass as Policy to atomic_control_and_value to inform regarding what type of increment & decrement should be done.
@@ -122,15 +243,47 @@ namespace sh::pointer
 				ctrl->weak_dec();
 			}
 		}
+		static void increment(control* const ctrl, const use_count_t count) noexcept
+		{
+			if (ctrl && count > 0)
+			{
+				ctrl->weak_inc(count);
+			}
+		}
+		static void decrement(control* const ctrl, const use_count_t count) noexcept
+		{
+			if (ctrl && count > 0)
+			{
+				ctrl->weak_dec(count);
+			}
+		}
+		/**	Release references to a control block replaced within an atomic. Values aren't borrowed via weak references.
+		 */
+		static void release_replaced(control* const ctrl, const use_count_t count) noexcept
+		{
+			decrement(ctrl, count);
+		}
+		/**	Retain a control block replaced within an atomic & handed to the caller. Values aren't borrowed via weak references.
+		 */
+		static void retain_replaced(control*) noexcept
+		{ }
 	};
 
 	/**	Base implementation of an atomic convertible_control for use in atomic shared_ptr and weak_ptr.
-	 *	@tparam Policy CRTP type for implementor class with increment & decrement static member functions.
+	 *	@tparam Policy CRTP type for implementor class with increment, decrement, release_replaced, & retain_replaced static member functions.
 	 *	@detail Holds a pointer to a pointer::convertible_control structure. This structure is aligned such that an
-	 *		offset returns a pointer to a value in memory, making storage of the value pointer unnecessary. Access to
-	 *		the pointer to pointer::convertible_control is locked by spinning to set the least significant bit to one.
+	 *		offset returns a pointer to a value in memory, making storage of the value pointer unnecessary.
+	 *
+	 *		Reference counting is split between a local count, packed into otherwise unused bits of m_ctrl, and the
+	 *		global count held by the control block. A load borrows a reference by incrementing the local count (a
+	 *		single read-modify-write that also protects the control block from release), takes a global reference of
+	 *		its own, then returns the borrowed local count. A writer replacing the control block first transfers any
+	 *		outstanding local count into the global count, so loads that find their borrow transferred simply release
+	 *		one global reference. No operation waits upon another, and use_count remains exact whenever no load is in
+	 *		progress.
+	 *
 	 *		To support wait and notify, both are done upon the single contained atomic, holding the pointer to
-	 *		pointer::convertible_control.
+	 *		pointer::convertible_control and its local count.
 	 */
 	template <typename Policy>
 	class atomic_convertible_control
@@ -139,29 +292,34 @@ namespace sh::pointer
 		/**	Constructor for nullptr.
 		 */
 		constexpr atomic_convertible_control(std::nullptr_t) noexcept
-			: m_ctrl{ nullptr }
+			: m_ctrl{ 0 }
 		{ }
 		/**	Constructor allowing non-null control.
 		 *	@param ctrl_with_one_inc If non-null, a pointer to a control block from which a (Policy-style) increment is inherited.
 		 */
 		constexpr explicit atomic_convertible_control(convertible_control* const ctrl_with_one_inc) noexcept
-			: m_ctrl{ ctrl_with_one_inc }
+			: m_ctrl{ to_word(ctrl_with_one_inc) }
 		{ }
 		/**	Destructor which will release one (Policy-style) reference count via decrement.
 		 */
 		~atomic_convertible_control()
 		{
-			convertible_control* const ctrl = this->m_ctrl.load(std::memory_order_acquire);
-			Policy::decrement(ctrl);
+			const word_t word = this->m_ctrl.load(std::memory_order_acquire);
+			SH_POINTER_ASSERT(to_count(word) == 0, "Didn't expect a load in progress during destruction.");
+			// Loads can't be in progress, so any borrow of ctrl from this atomic began before destruction:
+			Policy::release_replaced(to_ctrl(word), 1);
 		}
 		constexpr atomic_convertible_control() noexcept = delete;
 		atomic_convertible_control(const atomic_convertible_control&) = delete;
 		atomic_convertible_control& operator=(const atomic_convertible_control&) = delete;
 
-		static constexpr bool is_always_lock_free = false;
+		/**	Lock free if the local count can be incremented by a single fetch_add (i.e., it is held in the most
+		 *	significant bits of m_ctrl). Otherwise, loads may briefly spin when very many are simultaneously in progress.
+		 */
+		static constexpr bool is_always_lock_free = SH_POINTER_ATOMIC_HIGH_BITS > 0 && std::atomic<std::uintptr_t>::is_always_lock_free;
 		constexpr bool is_lock_free() const noexcept
 		{
-			return false;
+			return is_always_lock_free;
 		}
 
 		/**	Assign the pointer::convertible_control.
@@ -170,12 +328,9 @@ namespace sh::pointer
 		 */
 		void store(convertible_control* const&& desired_with_one_inc, const std::memory_order order) noexcept
 		{
-			// Lock:
-			convertible_control* const previous_ctrl = this->lock_load(order, std::memory_order_acquire);
-			// Unlock & inherit increment from desired_with_one_inc:
-			this->unlock_store(desired_with_one_inc, order);
-			// Decrement previous m_ctrl outside of lock:
-			Policy::decrement(previous_ctrl);
+			// Release m_ctrl's reference along with any surplus from replacement:
+			const replaced_t replaced = this->replace(to_word(desired_with_one_inc), order);
+			Policy::release_replaced(replaced.m_ctrl, 1 + replaced.m_surplus);
 		}
 		/**	Return the pointer::convertible_control pointer.
 		 *	@param order The memory synchronization ordering for the read operation.
@@ -183,13 +338,13 @@ namespace sh::pointer
 		 */
 		[[nodiscard]] convertible_control* load(const std::memory_order order) const noexcept
 		{
-			// Lock:
-			convertible_control* const ctrl_with_one_inc = this->lock_load(order, std::memory_order_acquire);
-			// Increment m_ctrl under lock in order to hand out via return:
+			// Borrow from the local count, protecting ctrl from release:
+			const word_t borrowed = this->borrow(load_order(order));
+			convertible_control* const ctrl_with_one_inc = to_ctrl(borrowed);
+			// Increment the global count in order to hand out via return:
 			Policy::increment(ctrl_with_one_inc);
-			// Unlock using seq_cst to prevent increment from reordering after this:
-			this->unlock_store(ctrl_with_one_inc, std::memory_order_seq_cst);
-			// Return retains increment made within lock above:
+			// Give back the local count (or release it if transferred):
+			this->return_borrow(borrowed);
 			return ctrl_with_one_inc;
 		}
 		/**	Exchange the pointer::convertible_control pointer.
@@ -199,10 +354,11 @@ namespace sh::pointer
 		 */
 		[[nodiscard]] convertible_control* exchange(convertible_control* const&& desired_with_one_inc, const std::memory_order order) noexcept
 		{
-			// Exchange (locks then unlocks), setting desired & inheriting increment already on desired_with_one_inc:
-			convertible_control* const ctrl_with_one_inc = this->lock_exchange(desired_with_one_inc, order, std::memory_order_acquire);
-			// Return retains increment made previously:
-			return ctrl_with_one_inc;
+			const replaced_t replaced = this->replace(to_word(desired_with_one_inc), order);
+			// Return retains m_ctrl's reference, so only release surplus:
+			Policy::decrement(replaced.m_ctrl, replaced.m_surplus);
+			Policy::retain_replaced(replaced.m_ctrl);
+			return replaced.m_ctrl;
 		}
 		/**	Compare and exchange the pointer::convertible_control pointer.
 		 *	@param expected_with_one_inc The value expected to find in m_ctrl. Reference count not modified upon success. Reference count will be decremented upon failure, value changed to refer to value that was found in m_ctrl, and an increment applied to that new value.
@@ -217,32 +373,46 @@ namespace sh::pointer
 			const std::memory_order order_success,
 			const std::memory_order order_failure) noexcept
 		{
-			// Lock:
-			convertible_control* const ctrl_with_one_inc = this->lock_load_expected(expected_with_one_inc, order_success, order_failure);
-			// Check ctrl equal to expected?
-			const bool as_expected = ctrl_with_one_inc == expected_with_one_inc;
-			if (as_expected)
+			SH_POINTER_ASSERT(
+				order_failure != std::memory_order_release
+				&& order_failure != std::memory_order_acq_rel,
+				"std::atomic::load doesn't expect release order");
+			const word_t desired = to_word(desired_with_one_inc);
+
+			// Without a load in progress, no local count need be transferred:
+			word_t expected = to_word(expected_with_one_inc);
+			if (this->m_ctrl.compare_exchange_strong(expected, desired, replace_order(order_success), std::memory_order_relaxed))
 			{
-				// Unlock & inherit increment from desired:
-				this->unlock_store(desired_with_one_inc, order_success);
-				// Decrement previous m_ctrl outside of lock:
-				Policy::decrement(ctrl_with_one_inc);
-				// Leave expected alone, retaining its increment.
+				// Release m_ctrl's reference. Leave expected alone, retaining its increment.
+				Policy::release_replaced(expected_with_one_inc, 1);
+				return true;
 			}
-			else
+
+			for (;;)
 			{
-				// Increment m_ctrl under lock in order to hand out via expected:
-				Policy::increment(ctrl_with_one_inc);
-				// Unlock using seq_cst to prevent increment from reordering after this:
-				this->unlock_store(ctrl_with_one_inc, std::memory_order_seq_cst);
-				// Decrement previous expected:
-				Policy::decrement(expected_with_one_inc);
-				// Report witnessed value of ctrl into expected:
-				expected_with_one_inc = ctrl_with_one_inc;
-				// Decrement desired that went unused:
-				Policy::decrement(desired_with_one_inc);
+				const word_t borrowed = this->borrow(load_order(order_failure));
+				convertible_control* const ctrl = to_ctrl(borrowed);
+				if (ctrl != expected_with_one_inc)
+				{
+					// Increment the global count in order to hand out via expected:
+					Policy::increment(ctrl);
+					this->return_borrow(borrowed);
+					// Decrement previous expected:
+					Policy::decrement(expected_with_one_inc);
+					// Report witnessed value of ctrl into expected:
+					expected_with_one_inc = ctrl;
+					// Decrement desired that went unused:
+					Policy::decrement(desired_with_one_inc);
+					return false;
+				}
+				use_count_t surplus;
+				if (this->replace_borrowed(borrowed, desired, order_success, surplus))
+				{
+					// Release m_ctrl's reference, the borrow, and any surplus. Leave expected alone, retaining its increment.
+					Policy::release_replaced(ctrl, 2 + surplus);
+					return true;
+				}
 			}
-			return as_expected;
 		}
 		/**	Compare and exchange the pointer::convertible_control pointer.
 		 *	@param expected_with_one_inc The value expected to find in m_ctrl. Reference count not modified upon success. Reference count will be decremented upon failure, value changed to refer to value that was found in m_ctrl, and an increment applied to that new value.
@@ -311,7 +481,16 @@ namespace sh::pointer
 				|| order == std::memory_order_acquire
 				|| order == std::memory_order_seq_cst,
 				"std::atomic::wait doesn't expect release order");
-			this->m_ctrl.wait(old, order);
+			for (;;)
+			{
+				const word_t word = this->m_ctrl.load(order);
+				if (to_ctrl(word) != old)
+				{
+					break;
+				}
+				// Changes to the local count alone will wake & loop back here.
+				this->m_ctrl.wait(word, order);
+			}
 		}
 		/**	Notify one thread waiting on m_ctrl via wait.
 		 */
@@ -325,136 +504,195 @@ namespace sh::pointer
 		{
 			this->m_ctrl.notify_all();
 		}
+		/**	Return the pointer::convertible_control pointer without borrowing a reference to it.
+		 *	@param order The memory synchronization ordering for the read operation.
+		 *	@return The value of m_ctrl, which may be released at any time unless otherwise protected (e.g., by a hazard).
+		 */
+		[[nodiscard]] convertible_control* peek(const std::memory_order order) const noexcept
+		{
+			return to_ctrl(this->m_ctrl.load(order));
+		}
 
 	private:
-		static_assert(alignof(convertible_control) >= 2, "Alignment of control block must be at least 2-bytes to leave zeroed bits to hold bit_locked.");
-		/**	Bit set within m_ctrl when this atomic_convertible_control & its contents are locked.
+		using word_t = std::uintptr_t;
+
+		/**	True if the local count is held in the most significant bits of m_ctrl and incremented by fetch_add.
+		 *	Otherwise, it's held in the least significant bits left zero by alignment and incremented by compare-and-exchange.
+		 */
+		static constexpr bool count_by_fetch_add{ SH_POINTER_ATOMIC_HIGH_BITS > 0 };
+		static_assert(count_by_fetch_add || alignof(convertible_control) >= 8,
+			"Alignment of control block must be at least 8-bytes to leave zeroed bits to hold a local count.");
+		/**	The position of the least significant bit of the local count within m_ctrl.
+		 */
+		static constexpr unsigned count_shift{ count_by_fetch_add ? unsigned(sizeof(word_t) * CHAR_BIT - SH_POINTER_ATOMIC_HIGH_BITS) : 0u };
+		/**	The bits of m_ctrl holding the local count.
 		 */
-		static constexpr std::uintptr_t bit_locked{ 0b01 };
+		static constexpr word_t count_mask{ count_by_fetch_add ? ~word_t{ 0 } << count_shift : word_t{ alignof(convertible_control) - 1 } };
+		/**	One local count, as added to m_ctrl.
+		 */
+		static constexpr word_t count_one{ word_t{ 1 } << count_shift };
+		/**	The largest local count representable within m_ctrl.
+		 */
+		static constexpr word_t count_max{ count_mask >> count_shift };
 
-		/**	Exchange m_ctrl.
-		 *	@param desired The desired value to exchange into m_ctrl. If bit_locked set, will achieve a lock upon return.
-		 *	@param order_success The memory synchronization ordering for the read-modify-write operation upon success.
-		 *	@param order_load_and_failure The memory synchronization ordering for the initial load operation and the load operation upon comparison failure.
-		 *	@return The previous value that was replaced, without any meta data bits, dereferencable as a pointer.
+		/**	The result of replacing m_ctrl.
 		 */
-		[[nodiscard]] convertible_control* lock_exchange(
-			convertible_control* const desired,
-			const std::memory_order order_success,
-			const std::memory_order order_load_and_failure) const noexcept
+		struct replaced_t final
 		{
-			SH_POINTER_ASSERT((reinterpret_cast<std::uintptr_t>(static_cast<void*>(desired)) & bit_locked) == 0,
-				"Didn't expect to exchange to desired value with bit_locked set.");
-			SH_POINTER_ASSERT(
-				order_load_and_failure != std::memory_order_release
-				&& order_load_and_failure != std::memory_order_acq_rel,
-				"std::atomic::load doesn't expect release order");
-			atomic_control_spin_waiter waiter;
-			convertible_control* expected = this->m_ctrl.load(order_load_and_failure);
-			for (;;)
+			/**	The replaced control block, retaining the reference held by m_ctrl.
+			 */
+			convertible_control* m_ctrl;
+			/**	The number of additional references to the replaced control block that the caller must release.
+			 */
+			use_count_t m_surplus;
+		};
+
+		static word_t to_word(convertible_control* const ctrl) noexcept
+		{
+			const word_t word{ reinterpret_cast<word_t>(static_cast<void*>(ctrl)) };
+			SH_POINTER_ASSERT((word & count_mask) == 0, "Didn't expect control block address to overlap local count bits.");
+			return word;
+		}
+		static convertible_control* to_ctrl(const word_t word) noexcept
+		{
+			return static_cast<convertible_control*>(reinterpret_cast<void*>(word & ~count_mask));
+		}
+		static use_count_t to_count(const word_t word) noexcept
+		{
+			return use_count_t((word & count_mask) >> count_shift);
+		}
+		/**	Return an order suitable for borrowing: at least acquire, as the borrower will access the control block.
+		 */
+		static constexpr std::memory_order load_order(const std::memory_order order) noexcept
+		{
+			return order == std::memory_order_seq_cst ? std::memory_order_seq_cst : std::memory_order_acquire;
+		}
+		/**	Return an order suitable for replacing m_ctrl: always seq_cst, as transfers to the replaced control block
+		 *	must be visible to borrowers before they observe replacement, the replacer may release the last reference,
+		 *	and replaced_hooks must be loaded after replacement. This costs nothing over acq_rel on x86-64 & AArch64.
+		 */
+		static constexpr std::memory_order replace_order(std::memory_order) noexcept
+		{
+			return std::memory_order_seq_cst;
+		}
+
+		/**	Increment the local count of m_ctrl.
+		 *	@param order The memory synchronization ordering for the read-modify-write operation.
+		 *	@return The value of m_ctrl including the increment.
+		 */
+		[[nodiscard]] word_t borrow(const std::memory_order order) const noexcept
+		{
+			if constexpr (count_by_fetch_add)
+			{
+				const word_t previous = this->m_ctrl.fetch_add(count_one, order);
+				SH_POINTER_ASSERT(to_count(previous) < count_max, "Local count overflow.");
+				return previous + count_one;
+			}
+			else
 			{
-				// Control-with-meta will have bit_locked unset.
-				const std::uintptr_t ctrl_meta{ reinterpret_cast<std::uintptr_t>(static_cast<void*>(expected)) & ~bit_locked };
-
-				// No exchange should be done if m_ctrl is presently locked
-				// (bit_locked is set). Ensure expected has bit_locked unset.
-				expected = static_cast<convertible_control*>(reinterpret_cast<void*>(ctrl_meta));
-
-				if (this->m_ctrl.compare_exchange_weak(
-						expected,
-						desired,
-						order_success,
-						order_load_and_failure
-					)
-				)
+				atomic_control_spin_waiter waiter;
+				word_t expected = this->m_ctrl.load(std::memory_order_relaxed);
+				for (;;)
 				{
-					// Success.
-					break;
+					if (to_count(expected) == count_max)
+					{
+						// Saturated: wait for another load to return its borrow.
+						waiter.wait();
+						expected = this->m_ctrl.load(std::memory_order_relaxed);
+					}
+					else if (this->m_ctrl.compare_exchange_weak(expected, expected + count_one, order, std::memory_order_relaxed))
+					{
+						return expected + count_one;
+					}
 				}
-
-				// Failure, wait for m_ctrl to be unlocked.
-				waiter.wait();
 			}
-			// Expected already must be missing bit_locked per the compare and
-			// exchange above. Unset that to return a usable (dereferencable)
-			// convertible_control pointer to the caller:
-			return expected;
 		}
-		/**	Lock and return the locked value of m_ctrl.
-		 *	@param expected The expected initial value of m_ctrl.
-		 *	@param order_success The memory synchronization ordering for the read-modify-write operation upon success.
-		 *	@param order_load The memory synchronization ordering for the load operation upon comparison failure.
-		 *	@return The value of m_ctrl at the time of locking, without any meta data bits, dereferencable as a pointer.
+		/**	Decrement the local count of m_ctrl if it still refers to the borrowed control block. If it does not, a
+		 *	writer has transferred the borrowed count to the control block, so release that reference instead.
+		 *	@param expected The value of m_ctrl including the increment, as returned by borrow.
 		 */
-		[[nodiscard]] convertible_control* lock_load_expected(
-			convertible_control* expected,
-			const std::memory_order order_success,
-			const std::memory_order order_load) const noexcept
+		void return_borrow(word_t expected) const noexcept
 		{
-			SH_POINTER_ASSERT(
-				order_load != std::memory_order_release
-				&& order_load != std::memory_order_acq_rel,
-				"std::atomic::load doesn't expect release order");
-			atomic_control_spin_waiter waiter;
-			for (;;)
+			convertible_control* const ctrl = to_ctrl(expected);
+			// Any local count held against ctrl is as good as our own.
+			while (to_ctrl(expected) == ctrl && to_count(expected) > 0)
 			{
-				// Control-with-meta will have bit_locked unset.
-				const std::uintptr_t ctrl_meta{ reinterpret_cast<std::uintptr_t>(static_cast<void*>(expected)) & ~bit_locked };
-
-				// No exchange should be done if m_ctrl is presently locked
-				// (bit_locked is set). Ensure expected has bit_locked unset.
-				expected = static_cast<convertible_control*>(reinterpret_cast<void*>(ctrl_meta));
-
-				if (this->m_ctrl.compare_exchange_weak(
-						expected,
-						static_cast<convertible_control*>(reinterpret_cast<void*>(ctrl_meta | bit_locked)),
-						order_success,
-						order_load
-					)
-				)
+				// Release so our global increment happens before a writer that
+				// no longer sees this borrow releases ctrl:
+				if (this->m_ctrl.compare_exchange_weak(expected, expected - count_one, std::memory_order_release, std::memory_order_acquire))
 				{
-					// Success.
-					break;
+					return;
 				}
-
-				// Failure, wait for m_ctrl to be unlocked.
-				waiter.wait();
 			}
-			// Expected already must be missing bit_locked per the compare and
-			// exchange above. Unset that to return a usable (dereferencable)
-			// convertible_control pointer to the caller:
-			return expected;
+			Policy::decrement(ctrl);
 		}
-		/**	Lock and return the locked value of m_ctrl.
-		 *	@param order_success The memory synchronization ordering for the read-modify-write operation upon success.
-		 *	@param order_load_and_failure The memory synchronization ordering for the initial load operation and the load operation upon comparison failure.
-		 *	@return The value of m_ctrl at the time of locking, without any meta data bits, dereferencable as a pointer.
+		/**	Replace m_ctrl with desired if it still refers to the control block of a borrow, first transferring all
+		 *	local count (including the borrow) to that control block.
+		 *	@param expected The value of m_ctrl including the increment, as returned by borrow.
+		 *	@param desired The value to store into m_ctrl.
+		 *	@param order The memory synchronization ordering for the read-modify-write operation upon success.
+		 *	@param surplus Upon success, set to the number of references transferred beyond the borrow and the local
+		 *		count remaining at replacement.
+		 *	@return True if replaced. False if another writer replaced the control block first, in which case the borrow
+		 *		has been released.
 		 */
-		[[nodiscard]] convertible_control* lock_load(const std::memory_order order_success, const std::memory_order order_load_and_failure) const noexcept
+		[[nodiscard]] bool replace_borrowed(word_t expected, const word_t desired, const std::memory_order order, use_count_t& surplus) noexcept
 		{
-			return this->lock_load_expected(this->m_ctrl.load(order_load_and_failure), order_success, order_load_and_failure);
+			convertible_control* const ctrl = to_ctrl(expected);
+			use_count_t transferred{ 0 };
+			while (to_ctrl(expected) == ctrl)
+			{
+				// Transfer before replacement such that any borrower that
+				// observes replacement may release its reference at once:
+				const use_count_t count = to_count(expected);
+				if (count > transferred)
+				{
+					Policy::increment(ctrl, count - transferred);
+					transferred = count;
+				}
+				if (this->m_ctrl.compare_exchange_weak(expected, desired, replace_order(order), std::memory_order_acquire))
+				{
+					// Borrows returned while transferring leave a surplus.
+					surplus = transferred - count;
+					return true;
+				}
+			}
+			// Another writer transferred our borrow. Release it along with
+			// whatever we transferred ourselves:
+			Policy::decrement(ctrl, transferred + 1);
+			return false;
 		}
-		/**	Store a value into m_ctrl with the intention of unlocking.
-		 *	@param ctrl The exact value to store into m_ctrl. Any meta data bits will be retained. Shouldn't have bit_locked set in order to unlock.
-		 *	@param order The memory ordering of the store. One of memory_order_relaxed, memory_order_release, memory_order_seq_cst, memory_order_consume.
+		/**	Replace m_ctrl with desired, transferring any local count to the control block replaced.
+		 *	@param desired The value to store into m_ctrl.
+		 *	@param order The memory synchronization ordering for the read-modify-write operation.
+		 *	@return The replaced control block & the references beyond m_ctrl's own to release.
 		 */
-		void unlock_store(convertible_control* const ctrl, const std::memory_order order) const noexcept
+		[[nodiscard]] replaced_t replace(const word_t desired, const std::memory_order order) noexcept
 		{
-			SH_POINTER_ASSERT(
-				order == std::memory_order_relaxed
-				|| order == std::memory_order_consume
-				|| order == std::memory_order_release
-				|| order == std::memory_order_seq_cst,
-				"std::atomic::store expected release order");
-			SH_POINTER_ASSERT((reinterpret_cast<std::uintptr_t>(static_cast<void*>(ctrl)) & bit_locked) == 0,
-				"Didn't expect to store ctrl value with bit_locked set.");
-			this->m_ctrl.store(ctrl, order);
+			// Without a load in progress, no local count need be transferred:
+			word_t expected = this->m_ctrl.load(std::memory_order_relaxed);
+			if (to_count(expected) == 0
+				&& this->m_ctrl.compare_exchange_strong(expected, desired, replace_order(order), std::memory_order_relaxed))
+			{
+				return replaced_t{ to_ctrl(expected), 0 };
+			}
+			for (;;)
+			{
+				// Borrow to keep the control block alive while transferring:
+				const word_t borrowed = this->borrow(std::memory_order_acquire);
+				use_count_t surplus;
+				if (this->replace_borrowed(borrowed, desired, order, surplus))
+				{
+					// Our borrow was transferred too.
+					return replaced_t{ to_ctrl(borrowed), use_count_t(1 + surplus) };
+				}
+			}
 		}
 
-		/**	Pointer to a pointer::convertible_control structure. Maybe be nullptr.
-		 *	@note This pointer may be manipulated by having bit_locked set. If m_ctrl could possibly be locked, that bit must be cleared before dereferencing.
+		/**	Pointer to a pointer::convertible_control structure, maybe nullptr, combined with a local count in bits
+		 *	selected by count_mask. Bits in count_mask must be cleared before dereferencing.
 		 */
-		mutable std::atomic<convertible_control*> m_ctrl;
+		mutable std::atomic<word_t> m_ctrl;
 	};
 
 } // namespace sh::pointer
@@ -463,6 +701,8 @@ template <typename T>
 struct std::atomic<sh::shared_ptr<T>> : private sh::pointer::atomic_convertible_control<sh::pointer::shared_policy>
 {
 	using atomic_control = sh::pointer::atomic_convertible_control<sh::pointer::shared_policy>;
+	friend class sh::pointer::hazard_domain;
+	friend class sh::rcu_read_guard;
 
 public:
 	using value_type = sh::shared_ptr<T>;
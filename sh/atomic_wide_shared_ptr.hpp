@@ -33,10 +33,29 @@
 #define INC_SH__ATOMIC_WIDE_SHARED_PTR_HPP
 
 #include <atomic>
+#include <climits>
+#include <cstdint>
 
 #include "atomic_shared_ptr.hpp"
 #include "wide_shared_ptr.hpp"
 
+/**	Define SH_POINTER_DWCAS as 1 to use a double-width compare-and-swap for std::atomic<sh::wide_shared_ptr> and
+ *	std::atomic<sh::wide_weak_ptr>, making them lock free, or 0 to use a spin lock. Defaults to 1 on x86-64, where
+ *	CMPXCHG16B is available, provided SH_POINTER_ATOMIC_HIGH_BITS leaves room for a local count.
+ */
+#if !defined(SH_POINTER_DWCAS)
+	#if SH_POINTER_ATOMIC_HIGH_BITS > 0 \
+		&& ((defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))) || (defined(_M_X64) && defined(_MSC_VER)))
+		#define SH_POINTER_DWCAS 1
+	#else
+		#define SH_POINTER_DWCAS 0
+	#endif
+#endif // SH_POINTER_DWCAS
+
+#if SH_POINTER_DWCAS && defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif // SH_POINTER_DWCAS && _MSC_VER && !__clang__
+
 namespace sh::pointer
 {
 	/**	Base implementation of an atomic control & value pair for use in atomic wide_shared_ptr and wide_weak_ptr.
@@ -461,12 +480,528 @@ namespace sh::pointer
 		erased_t* m_value;
 	};
 
+#if SH_POINTER_DWCAS
+	/**	A pair of words updated together by dwcas_compare_exchange.
+	 */
+	struct alignas(2 * sizeof(std::uintptr_t)) dwcas_pair final
+	{
+		std::uintptr_t m_low;
+		std::uintptr_t m_high;
+	};
+
+	/**	Compare and exchange a pair of words as a single atomic (double-width compare-and-swap).
+	 *	@detail Implemented with LOCK CMPXCHG16B, which is a full barrier. Available on every x86-64 processor but the
+	 *		very earliest, yet not assumed by compilers without -mcx16, so it's issued directly.
+	 *	@param target The pair to update.
+	 *	@param expected The pair expected to find in target. Upon failure, assigned the pair found in target.
+	 *	@param desired The pair to exchange into target upon success.
+	 *	@return True if the compare and exchange succeeded. False otherwise.
+	 */
+	inline bool dwcas_compare_exchange(dwcas_pair& target, dwcas_pair& expected, const dwcas_pair desired) noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		return _InterlockedCompareExchange128(
+			reinterpret_cast<volatile long long*>(&target),
+			static_cast<long long>(desired.m_high),
+			static_cast<long long>(desired.m_low),
+			reinterpret_cast<long long*>(&expected)) != 0;
+#else // !_MSC_VER || __clang__
+		bool success;
+		__asm__ __volatile__(
+			"lock cmpxchg16b %1"
+			: "=@ccz"(success), "+m"(target), "+a"(expected.m_low), "+d"(expected.m_high)
+			: "b"(desired.m_low), "c"(desired.m_high)
+			: "memory");
+		return success;
+#endif // !_MSC_VER || __clang__
+	}
+
+	/**	Lock free implementation of an atomic control & value pair for use in atomic wide_shared_ptr and wide_weak_ptr.
+	 *	@tparam Policy CRTP type for implementor class with increment & decrement static member functions.
+	 *	@detail Holds a pointer to a pointer::control structure and a void pointer to data as a single double-width
+	 *		atomic, updated via dwcas_compare_exchange. Reference counting is split between a local count, held in
+	 *		the most significant bits of the control word, and the global count of the control block, as described
+	 *		by atomic_convertible_control. A load borrows by a compare-and-exchange of the whole pair, so concurrent
+	 *		loads contend with one another as well as with writes: uncontended, a load takes a single
+	 *		compare-and-exchange, but under contention loads & writes are only lock free, not wait free. To support
+	 *		wait and notify, both are done upon the control word, whose bit_notify bit is toggled when the value
+	 *		changes without the control block changing.
+	 */
+	template <typename Policy>
+	class atomic_dwcas_control_and_value
+	{
+	public:
+		/**	Type alias for value types that have been type erased inside atomic_dwcas_control_and_value.
+		 */
+		using erased_t = void;
+
+		/**	Constructor for nullptr (neither control nor value).
+		 */
+		atomic_dwcas_control_and_value(std::nullptr_t, std::nullptr_t) noexcept
+			: m_pair{ 0, 0 }
+		{ }
+		/**	Constructor allowing non-null control & value.
+		 *	@param ctrl_with_one_inc If non-null, a pointer to a control block from which a (Policy-style) increment is inherited.
+		 *	@param value A value pointer associated with the given control block.
+		 */
+		atomic_dwcas_control_and_value(control* const ctrl_with_one_inc, erased_t* const value) noexcept
+			: m_pair{ to_word(ctrl_with_one_inc), to_word(value) }
+		{ }
+		/**	Destructor which will release one (Policy-style) reference count via decrement.
+		 */
+		~atomic_dwcas_control_and_value()
+		{
+			const dwcas_pair current = this->load_pair();
+			SH_POINTER_ASSERT(to_count(current.m_low) == 0, "Didn't expect a load in progress during destruction.");
+			Policy::decrement(to_ctrl(current.m_low));
+		}
+		// Disable default & copy construction, copy assignment.
+		constexpr atomic_dwcas_control_and_value() noexcept = delete;
+		atomic_dwcas_control_and_value(const atomic_dwcas_control_and_value&) = delete;
+		atomic_dwcas_control_and_value& operator=(const atomic_dwcas_control_and_value&) = delete;
+
+		static constexpr bool is_always_lock_free = true;
+		constexpr bool is_lock_free() const noexcept
+		{
+			return true;
+		}
+
+		/**	Assign the pointer::control and value pointers.
+		 *	@param desired_with_one_inc The value to exchange into m_ctrl. Reference count will be assumed.
+		 *	@param desired_value The value to exchange into m_value.
+		 *	@param order Unused, as every update is sequentially consistent.
+		 */
+		void store(control* const&& desired_ctrl_with_one_inc, erased_t* const desired_value, const std::memory_order) noexcept
+		{
+			const replaced_t replaced = this->replace(desired_ctrl_with_one_inc, desired_value);
+			// Release the previous reference along with any surplus from replacement:
+			Policy::decrement(replaced.m_ctrl, 1 + replaced.m_surplus);
+		}
+		/**	Return the pointer::control and value pointers.
+		 *	@param order Unused, as every update is sequentially consistent.
+		 *	@return The value of m_ctrl (with an incremented reference count) and m_value.
+		 */
+		[[nodiscard]] std::pair<control*, erased_t*> load(const std::memory_order) const noexcept
+		{
+			// Borrow from the local count, protecting ctrl from release:
+			const dwcas_pair borrowed = this->borrow();
+			control* const ctrl_with_one_inc = to_ctrl(borrowed.m_low);
+			// Increment the global count in order to hand out via return:
+			Policy::increment(ctrl_with_one_inc);
+			// Give back the local count (or release it if transferred):
+			this->return_borrow(borrowed);
+			return { ctrl_with_one_inc, to_value(borrowed.m_high) };
+		}
+		/**	Exchange the pointer::control and value pointers with those given.
+		 *	@param desired_with_one_inc The value to exchange into m_ctrl. Reference count will be assumed.
+		 *	@param desired_value The value to exchange into m_value.
+		 *	@param order Unused, as every update is sequentially consistent.
+		 *	@return The previous values of m_ctrl (retaining its reference count) and m_value.
+		 */
+		[[nodiscard]] std::pair<control*, erased_t*> exchange(
+			control* const&& desired_ctrl_with_one_inc,
+			erased_t* const desired_value,
+			const std::memory_order) noexcept
+		{
+			const replaced_t replaced = this->replace(desired_ctrl_with_one_inc, desired_value);
+			// Return retains the previous reference, so only release surplus:
+			Policy::decrement(replaced.m_ctrl, replaced.m_surplus);
+			return { replaced.m_ctrl, replaced.m_value };
+		}
+
+		/**	Compare and exchange the pointer::control and value pointers.
+		 *	@param expected_with_one_inc The value expected to find in m_ctrl. Reference count not modified upon success. Reference count will be decremented upon failure, value changed to refer to value that was found in m_ctrl, and an increment applied to that new value.
+		 *	@param expected_value The value expected to find in m_value. Upon failure, will be assigned to refer to the value that was found in m_value.
+		 *	@param desired_with_one_inc The value to exchange into m_ctrl. Reference count will be assumed upon success. Reference count will be decremented upon failure.
+		 *	@param desired_value The value to exchange into m_value.
+		 *	@param order_success Unused, as every update is sequentially consistent.
+		 *	@param order_failure Unused, as every update is sequentially consistent.
+		 *	@return True if the compare and exchange succeeded. False otherwise.
+		 */
+		[[nodiscard]] bool compare_exchange_strong(
+			control*& expected_ctrl_with_one_inc, erased_t*& expected_value,
+			control* const&& desired_ctrl_with_one_inc, erased_t* const&& desired_value,
+			const std::memory_order,
+			[[maybe_unused]] const std::memory_order order_failure) noexcept
+		{
+			SH_POINTER_ASSERT(
+				order_failure != std::memory_order_release
+				&& order_failure != std::memory_order_acq_rel,
+				"std::atomic::load doesn't expect release order");
+
+			// Without a load in progress, no local count need be transferred:
+			dwcas_pair expected = this->load_relaxed();
+			while (to_ctrl(expected.m_low) == expected_ctrl_with_one_inc
+				&& to_value(expected.m_high) == expected_value
+				&& to_count(expected.m_low) == 0)
+			{
+				if (dwcas_compare_exchange(this->m_pair, expected, to_desired(expected, desired_ctrl_with_one_inc, desired_value)))
+				{
+					// Release the previous reference. Leave expected alone, retaining its increment.
+					Policy::decrement(expected_ctrl_with_one_inc);
+					return true;
+				}
+			}
+
+			for (;;)
+			{
+				const dwcas_pair borrowed = this->borrow();
+				control* const ctrl = to_ctrl(borrowed.m_low);
+				if (ctrl != expected_ctrl_with_one_inc || to_value(borrowed.m_high) != expected_value)
+				{
+					// Report witnessed value into expected:
+					expected_value = to_value(borrowed.m_high);
+					// Increment the global count in order to hand out via expected:
+					Policy::increment(ctrl);
+					this->return_borrow(borrowed);
+					// Decrement previous expected:
+					Policy::decrement(expected_ctrl_with_one_inc);
+					// Report witnessed value of ctrl into expected:
+					expected_ctrl_with_one_inc = ctrl;
+					// Decrement desired that went unused:
+					Policy::decrement(desired_ctrl_with_one_inc);
+					return false;
+				}
+				dwcas_pair replaced = borrowed;
+				use_count_t surplus;
+				if (this->replace_borrowed(replaced, desired_ctrl_with_one_inc, desired_value, true, surplus))
+				{
+					// Release the previous reference, the borrow, and any surplus. Leave expected alone, retaining its increment.
+					Policy::decrement(ctrl, 2 + surplus);
+					return true;
+				}
+			}
+		}
+		/**	Compare and exchange the pointer::control and value pointers.
+		 *	@param expected_with_one_inc The value expected to find in m_ctrl. Reference count not modified upon success. Reference count will be decremented upon failure, value changed to refer to value that was found in m_ctrl, and an increment applied to that new value.
+		 *	@param expected_value The value expected to find in m_value. Upon failure, will be assigned to refer to the value that was found in m_value.
+		 *	@param desired_with_one_inc The value to exchange into m_ctrl. Reference count will be assumed upon success. Reference count will be decremented upon failure.
+		 *	@param desired_value The value to exchange into m_value.
+		 *	@param order_success Unused, as every update is sequentially consistent.
+		 *	@param order_failure Unused, as every update is sequentially consistent.
+		 *	@return True if the compare and exchange succeeded. False otherwise.
+		 */
+		[[nodiscard]] bool compare_exchange_weak(
+			control*& expected_ctrl_with_one_inc, erased_t*& expected_value,
+			control*&& desired_ctrl_with_one_inc, erased_t*&& desired_value,
+			const std::memory_order order_success,
+			const std::memory_order order_failure) noexcept
+		{
+			return this->compare_exchange_strong(
+				expected_ctrl_with_one_inc, expected_value,
+				std::move(desired_ctrl_with_one_inc), std::move(desired_value),
+				order_success, order_failure);
+		}
+		/**	Compare and exchange the pointer::control and value pointers.
+		 *	@param expected_with_one_inc The value expected to find in m_ctrl. Reference count not modified upon success. Reference count will be decremented upon failure, value changed to refer to value that was found in m_ctrl, and an increment applied to that new value.
+		 *	@param expected_value The value expected to find in m_value. Upon failure, will be assigned to refer to the value that was found in m_value.
+		 *	@param desired_with_one_inc The value to exchange into m_ctrl. Reference count will be assumed upon success. Reference count will be decremented upon failure.
+		 *	@param desired_value The value to exchange into m_value.
+		 *	@param order Unused, as every update is sequentially consistent.
+		 *	@return True if the compare and exchange succeeded. False otherwise.
+		 */
+		[[nodiscard]] bool compare_exchange_strong(
+			control*& expected_ctrl_with_one_inc, erased_t*& expected_value,
+			control*&& desired_ctrl_with_one_inc, erased_t*&& desired_value,
+			const std::memory_order order) noexcept
+		{
+			return this->compare_exchange_strong(
+				expected_ctrl_with_one_inc, expected_value,
+				std::move(desired_ctrl_with_one_inc), std::move(desired_value),
+				order, std::memory_order_relaxed);
+		}
+		/**	Compare and exchange the pointer::control and value pointers.
+		 *	@param expected_with_one_inc The value expected to find in m_ctrl. Reference count not modified upon success. Reference count will be decremented upon failure, value changed to refer to value that was found in m_ctrl, and an increment applied to that new value.
+		 *	@param expected_value The value expected to find in m_value. Upon failure, will be assigned to refer to the value that was found in m_value.
+		 *	@param desired_with_one_inc The value to exchange into m_ctrl. Reference count will be assumed upon success. Reference count will be decremented upon failure.
+		 *	@param desired_value The value to exchange into m_value.
+		 *	@param order Unused, as every update is sequentially consistent.
+		 *	@return True if the compare and exchange succeeded. False otherwise.
+		 */
+		[[nodiscard]] bool compare_exchange_weak(
+			control*& expected_ctrl_with_one_inc, erased_t*& expected_value,
+			control*&& desired_ctrl_with_one_inc, erased_t*&& desired_value,
+			const std::memory_order order) noexcept
+		{
+			return this->compare_exchange_strong(
+				expected_ctrl_with_one_inc, expected_value,
+				std::move(desired_ctrl_with_one_inc), std::move(desired_value),
+				order);
+		}
+
+		/**	Wait until either contained control or value pointer does not match the respective arguments given.
+		 *	@param old_ctrl The pointer::control address to await mismatch.
+		 *	@param old_value The data value pointer to await mismatch.
+		 *	@param order The desired memory ordering of the wait operation. One of: memory_order_relaxed, memory_order_acquire, memory_order_seq_cst, or memory_order_consume.
+		 */
+		void wait(control* const old_ctrl, const erased_t* const old_value, const std::memory_order order) const noexcept
+		{
+			SH_POINTER_ASSERT(
+				order != std::memory_order_release
+				&& order != std::memory_order_acq_rel,
+				"std::atomic::wait doesn't expect release order");
+			for (;;)
+			{
+				const dwcas_pair current = this->load_pair();
+				if (to_ctrl(current.m_low) != old_ctrl || to_value(current.m_high) != old_value)
+				{
+					// Break out of loop as either ctrl and/or value is different:
+					break;
+				}
+				// Wait until notify & the control word has been changed to try
+				// again. The bit_notify bit within the control word will be
+				// toggled if the value is changed but the same control kept:
+				this->ctrl_word().wait(current.m_low, order);
+			}
+		}
+		/**	Notify one thread waiting via wait.
+		 */
+		void notify_one() noexcept
+		{
+			this->ctrl_word().notify_one();
+		}
+		/**	Notify all threads waiting via wait.
+		 */
+		void notify_all() noexcept
+		{
+			this->ctrl_word().notify_all();
+		}
+
+	private:
+		using word_t = std::uintptr_t;
+
+		static_assert(alignof(control) >= 2, "Alignment of control block must be at least 2-bytes to leave a zeroed bit to hold bit_notify.");
+		static_assert(SH_POINTER_ATOMIC_HIGH_BITS > 0, "Expected the most significant bits of the control word to hold a local count.");
+		/**	Bit toggled within the control word when an assignment is made that changes the value without altering the control.
+		 */
+		static constexpr word_t bit_notify{ 0b1 };
+		/**	The position of the least significant bit of the local count within the control word.
+		 */
+		static constexpr unsigned count_shift{ unsigned(sizeof(word_t) * CHAR_BIT - SH_POINTER_ATOMIC_HIGH_BITS) };
+		/**	The bits of the control word holding the local count.
+		 */
+		static constexpr word_t count_mask{ ~word_t{ 0 } << count_shift };
+		/**	One local count, as added to the control word.
+		 */
+		static constexpr word_t count_one{ word_t{ 1 } << count_shift };
+		/**	The largest local count representable within the control word.
+		 */
+		static constexpr word_t count_max{ count_mask >> count_shift };
+
+		/**	The result of replacing m_pair.
+		 */
+		struct replaced_t final
+		{
+			/**	The replaced control block, retaining the reference held by m_pair.
+			 */
+			control* m_ctrl;
+			/**	The replaced value.
+			 */
+			erased_t* m_value;
+			/**	The number of additional references to the replaced control block that the caller must release.
+			 */
+			use_count_t m_surplus;
+		};
+
+		static word_t to_word(const void* const pointer) noexcept
+		{
+			const word_t word{ reinterpret_cast<word_t>(pointer) };
+			return word;
+		}
+		static word_t to_word(control* const ctrl) noexcept
+		{
+			const word_t word{ to_word(static_cast<const void*>(ctrl)) };
+			SH_POINTER_ASSERT((word & (count_mask | bit_notify)) == 0, "Didn't expect control block address to overlap local count or bit_notify.");
+			return word;
+		}
+		static control* to_ctrl(const word_t word) noexcept
+		{
+			return static_cast<control*>(reinterpret_cast<void*>(word & ~(count_mask | bit_notify)));
+		}
+		static erased_t* to_value(const word_t word) noexcept
+		{
+			return reinterpret_cast<erased_t*>(word);
+		}
+		static use_count_t to_count(const word_t word) noexcept
+		{
+			return use_count_t((word & count_mask) >> count_shift);
+		}
+		/**	Return the pair to exchange into m_pair in place of an expected pair.
+		 *	@param expected The pair presently expected within m_pair.
+		 *	@param desired_ctrl The control to store.
+		 *	@param desired_value The value to store.
+		 *	@return The pair to store, with no local count, and bit_notify toggled if only the value changes.
+		 */
+		static dwcas_pair to_desired(const dwcas_pair expected, control* const desired_ctrl, erased_t* const desired_value) noexcept
+		{
+			word_t desired_word{ to_word(desired_ctrl) };
+			if (to_ctrl(expected.m_low) == desired_ctrl)
+			{
+				desired_word |= (expected.m_low & bit_notify) ^ (to_value(expected.m_high) != desired_value ? bit_notify : 0);
+			}
+			return dwcas_pair{ desired_word, to_word(static_cast<const void*>(desired_value)) };
+		}
+
+		std::atomic_ref<word_t> ctrl_word() const noexcept
+		{
+			return std::atomic_ref<word_t>{ this->m_pair.m_low };
+		}
+		/**	Read m_pair without atomicity across both words, suitable only as an initial expected value.
+		 */
+		[[nodiscard]] dwcas_pair load_relaxed() const noexcept
+		{
+			return dwcas_pair{
+				std::atomic_ref<word_t>{ this->m_pair.m_low }.load(std::memory_order_relaxed),
+				std::atomic_ref<word_t>{ this->m_pair.m_high }.load(std::memory_order_relaxed)
+			};
+		}
+		/**	Read m_pair atomically by comparing and exchanging it with itself.
+		 */
+		[[nodiscard]] dwcas_pair load_pair() const noexcept
+		{
+			dwcas_pair expected = this->load_relaxed();
+			// Upon failure, expected is assigned the pair found.
+			(void)dwcas_compare_exchange(this->m_pair, expected, expected);
+			return expected;
+		}
+		/**	Increment the local count of m_pair. This retries while other loads or writes change m_pair, unlike the
+		 *	fetch_add of atomic_convertible_control, as the value word must be read atomically with the control word.
+		 *	@return The value of m_pair including the increment.
+		 */
+		[[nodiscard]] dwcas_pair borrow() const noexcept
+		{
+			dwcas_pair expected = this->load_relaxed();
+			for (;;)
+			{
+				SH_POINTER_ASSERT(to_count(expected.m_low) < count_max, "Local count overflow.");
+				const dwcas_pair desired{ expected.m_low + count_one, expected.m_high };
+				if (dwcas_compare_exchange(this->m_pair, expected, desired))
+				{
+					return desired;
+				}
+			}
+		}
+		/**	Decrement the local count of m_pair if it still refers to the borrowed control block. If it does not, a
+		 *	writer has transferred the borrowed count to the control block, so release that reference instead.
+		 *	@param expected The value of m_pair including the increment, as returned by borrow.
+		 */
+		void return_borrow(dwcas_pair expected) const noexcept
+		{
+			control* const ctrl = to_ctrl(expected.m_low);
+			// Any local count held against ctrl is as good as our own.
+			while (to_ctrl(expected.m_low) == ctrl && to_count(expected.m_low) > 0)
+			{
+				if (dwcas_compare_exchange(this->m_pair, expected, dwcas_pair{ expected.m_low - count_one, expected.m_high }))
+				{
+					return;
+				}
+			}
+			Policy::decrement(ctrl);
+		}
+		/**	Replace m_pair if it still refers to the control block of a borrow, first transferring all local count
+		 *	(including the borrow) to that control block.
+		 *	@param expected The value of m_pair including the increment, as returned by borrow. Upon success, assigned the replaced pair.
+		 *	@param desired_ctrl The control to store.
+		 *	@param desired_value The value to store.
+		 *	@param compare_value If true, only replace while the value is unchanged from \p expected.
+		 *	@param surplus Upon success, set to the number of references transferred beyond the borrow and the local
+		 *		count remaining at replacement.
+		 *	@return True if replaced. False otherwise, in which case the borrow has been released or returned.
+		 */
+		[[nodiscard]] bool replace_borrowed(
+			dwcas_pair& expected,
+			control* const desired_ctrl,
+			erased_t* const desired_value,
+			const bool compare_value,
+			use_count_t& surplus) noexcept
+		{
+			control* const ctrl = to_ctrl(expected.m_low);
+			const word_t value = expected.m_high;
+			use_count_t transferred{ 0 };
+			while (to_ctrl(expected.m_low) == ctrl && (compare_value == false || expected.m_high == value))
+			{
+				// Transfer before replacement such that any borrower that
+				// observes replacement may release its reference at once:
+				const use_count_t count = to_count(expected.m_low);
+				if (count > transferred)
+				{
+					Policy::increment(ctrl, count - transferred);
+					transferred = count;
+				}
+				if (dwcas_compare_exchange(this->m_pair, expected, to_desired(expected, desired_ctrl, desired_value)))
+				{
+					// Borrows returned while transferring leave a surplus.
+					surplus = transferred - count;
+					return true;
+				}
+			}
+			if (to_ctrl(expected.m_low) != ctrl)
+			{
+				// Another writer transferred our borrow. Release it along with
+				// whatever we transferred ourselves:
+				Policy::decrement(ctrl, transferred + 1);
+			}
+			else
+			{
+				// Only the value changed. Undo our transfer & give back the borrow:
+				Policy::decrement(ctrl, transferred);
+				this->return_borrow(expected);
+			}
+			return false;
+		}
+		/**	Replace m_pair, transferring any local count to the control block replaced.
+		 *	@param desired_ctrl The control to store.
+		 *	@param desired_value The value to store.
+		 *	@return The replaced control block & value, and the references beyond the replaced one to release.
+		 */
+		[[nodiscard]] replaced_t replace(control* const desired_ctrl, erased_t* const desired_value) noexcept
+		{
+			// Without a load in progress, no local count need be transferred:
+			dwcas_pair expected = this->load_relaxed();
+			while (to_count(expected.m_low) == 0)
+			{
+				if (dwcas_compare_exchange(this->m_pair, expected, to_desired(expected, desired_ctrl, desired_value)))
+				{
+					return replaced_t{ to_ctrl(expected.m_low), to_value(expected.m_high), 0 };
+				}
+			}
+			for (;;)
+			{
+				// Borrow to keep the control block alive while transferring:
+				expected = this->borrow();
+				use_count_t surplus;
+				if (this->replace_borrowed(expected, desired_ctrl, desired_value, false, surplus))
+				{
+					// Our borrow was transferred too.
+					return replaced_t{ to_ctrl(expected.m_low), to_value(expected.m_high), use_count_t(1 + surplus) };
+				}
+			}
+		}
+
+		/**	The control word, a pointer to a pointer::control structure (maybe nullptr) combined with a local count
+		 *	and bit_notify, and the value word, a pointer to data (maybe nullptr).
+		 */
+		mutable dwcas_pair m_pair;
+	};
+#endif // SH_POINTER_DWCAS
+
+	/**	The implementation of an atomic control & value pair used by atomic wide_shared_ptr and wide_weak_ptr:
+	 *	atomic_dwcas_control_and_value if double-width compare-and-swap is available, otherwise
+	 *	atomic_control_and_value.
+	 */
+	template <typename Policy>
+#if SH_POINTER_DWCAS
+	using atomic_wide_control_and_value = atomic_dwcas_control_and_value<Policy>;
+#else // !SH_POINTER_DWCAS
+	using atomic_wide_control_and_value = atomic_control_and_value<Policy>;
+#endif // !SH_POINTER_DWCAS
+
 } // namespace sh::pointer
 
 template <typename T>
-struct std::atomic<sh::wide_shared_ptr<T>> : private sh::pointer::atomic_control_and_value<sh::pointer::shared_policy>
+struct std::atomic<sh::wide_shared_ptr<T>> : private sh::pointer::atomic_wide_control_and_value<sh::pointer::shared_policy>
 {
-	using atomic_control_and_value = sh::pointer::atomic_control_and_value<sh::pointer::shared_policy>;
+	using atomic_control_and_value = sh::pointer::atomic_wide_control_and_value<sh::pointer::shared_policy>;
 
 public:
 	using value_type = sh::wide_shared_ptr<T>;
@@ -601,9 +1136,9 @@ private:
 };
 
 template <typename T>
-struct std::atomic<sh::wide_weak_ptr<T>> : private sh::pointer::atomic_control_and_value<sh::pointer::weak_policy>
+struct std::atomic<sh::wide_weak_ptr<T>> : private sh::pointer::atomic_wide_control_and_value<sh::pointer::weak_policy>
 {
-	using atomic_control_and_value = sh::pointer::atomic_control_and_value<sh::pointer::weak_policy>;
+	using atomic_control_and_value = sh::pointer::atomic_wide_control_and_value<sh::pointer::weak_policy>;
 
 public:
 	using value_type = sh::wide_weak_ptr<T>;
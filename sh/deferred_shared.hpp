@@ -0,0 +1,532 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__DEFERRED_SHARED_HPP
+#define INC_SH__DEFERRED_SHARED_HPP
+
+/**	@file
+ *	This file declares sh::deferred_reclaimer, sh::deferred_reclaim_thread,
+ *	sh::allocate_shared_deferred, and sh::make_shared_deferred, which move
+ *	the destruction of a sh::shared_ptr's value off of the thread that
+ *	releases the last reference to it:
+ *
+ *		sh::shared_ptr<T> x = sh::make_shared_deferred<T>(args...);
+ *		x.reset(); // Queued to a background thread rather than destroyed here.
+ *
+ *	Releasing the last shared reference to a deferred value pushes its
+ *	control block onto the lock-free queue of a deferred_reclaimer, waking a
+ *	waiting thread if the queue was empty. The value is destroyed & its
+ *	storage deallocated when the queue is pumped:
+ *
+ *		sh::deferred_reclaimer reclaimer;
+ *		sh::shared_ptr<T> y = sh::allocate_shared_deferred<T>(reclaimer, alloc, args...);
+ *		y.reset();
+ *		reclaimer.pump(); // Destroys y's value on this thread.
+ *
+ *	A sh::deferred_reclaim_thread pumps a reclaimer from a background thread
+ *	for its lifetime. sh::make_shared_deferred uses
+ *	sh::deferred_reclaimer::global(), which is pumped by a background thread
+ *	started upon first use.
+ *
+ *	Values are destroyed in the order their last references were released,
+ *	per releasing thread. Weak references may outlive the value as usual;
+ *	storage is deallocated only once both the value is destroyed & the last
+ *	weak reference is released.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "shared_ptr.hpp"
+
+namespace sh::pointer
+{
+	/**	An intrusive entry in a deferred_reclaimer's queue.
+	 */
+	struct deferred_node final
+	{
+		using reclaim_type = void(*)(deferred_node*) noexcept;
+
+		/**	The entry queued before this one.
+		 */
+		deferred_node* m_next{ nullptr };
+		/**	Called with this entry when it's pumped.
+		 */
+		reclaim_type m_reclaim{ nullptr };
+	};
+} // namespace sh::pointer
+
+namespace sh
+{
+	/**	A multiple producer queue of values whose destruction has been deferred.
+	 *	@detail Producers push with a single compare-exchange. Pumping takes the whole queue with a single exchange &
+	 *		so may be performed by any number of threads.
+	 */
+	class deferred_reclaimer final
+	{
+	public:
+		deferred_reclaimer() = default;
+		deferred_reclaimer(const deferred_reclaimer&) = delete;
+		deferred_reclaimer& operator=(const deferred_reclaimer&) = delete;
+		/**	Pump any values that remain queued.
+		 *	@note Values referencing this reclaimer must not be released after destruction begins.
+		 */
+		~deferred_reclaimer()
+		{
+			this->pump();
+		}
+
+		/**	Return the reclaimer used by make_shared_deferred, starting a deferred_reclaim_thread to pump it upon first use.
+		 *	@throw std::bad_alloc or std::system_error If the first call couldn't create the reclaimer or start its thread.
+		 *	@return A reference to the instance, which is never destroyed such that objects with static storage
+		 *		duration may safely release deferred values during their own destruction.
+		 */
+		static deferred_reclaimer& global();
+
+		/**	Queue an entry to be reclaimed by the next pump.
+		 *	@param node The entry, which mustn't already be queued.
+		 */
+		void enqueue(pointer::deferred_node& node) noexcept
+		{
+			pointer::deferred_node* head = m_head.load(std::memory_order_relaxed);
+			do
+			{
+				node.m_next = head;
+			}
+			while (false == m_head.compare_exchange_weak(head, &node, std::memory_order_release, std::memory_order_relaxed));
+			if (head == nullptr)
+			{
+				this->wake();
+			}
+		}
+		/**	Reclaim all entries queued before the call, on the calling thread.
+		 *	@return The number of entries reclaimed.
+		 */
+		std::size_t pump() noexcept
+		{
+			pointer::deferred_node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+			// Reverse into the order in which entries were queued.
+			pointer::deferred_node* reversed{ nullptr };
+			while (node)
+			{
+				reversed = std::exchange(node, std::exchange(node->m_next, reversed));
+			}
+			std::size_t count{ 0 };
+			while (reversed)
+			{
+				// Advance first, as reclaiming may deallocate the entry.
+				pointer::deferred_node& current = *std::exchange(reversed, reversed->m_next);
+				current.m_reclaim(&current);
+				++count;
+			}
+			return count;
+		}
+		/**	Return the number of wakes so far, to be read before checking any other reason to stop waiting & then passed
+		 *	to wait.
+		 */
+		std::uint32_t wake_count() const noexcept
+		{
+			return m_wakes.load(std::memory_order_acquire);
+		}
+		/**	Block the calling thread until an entry is queued or wake is called, unless either occurred since
+		 *	wake_count returned \p count.
+		 *	@param count A value returned by wake_count.
+		 */
+		void wait(const std::uint32_t count) const noexcept
+		{
+			if (m_head.load(std::memory_order_relaxed) == nullptr)
+			{
+				m_wakes.wait(count, std::memory_order_relaxed);
+			}
+		}
+		/**	Block the calling thread until an entry is queued or wake is called.
+		 */
+		void wait() const noexcept
+		{
+			this->wait(this->wake_count());
+		}
+		/**	Wake all threads blocked in wait, whether or not any entry is queued.
+		 */
+		void wake() noexcept
+		{
+			m_wakes.fetch_add(1, std::memory_order_release);
+			m_wakes.notify_all();
+		}
+		/**	Return true if no entries are queued.
+		 *	@note May change immediately after returning.
+		 */
+		bool empty() const noexcept
+		{
+			return m_head.load(std::memory_order_relaxed) == nullptr;
+		}
+
+	private:
+		/**	The most recently queued entry, which links to those queued before it.
+		 */
+		std::atomic<pointer::deferred_node*> m_head{ nullptr };
+		/**	Incremented by each wake, upon which waiting threads block rather than m_head so that they may also be woken
+		 *	while entries are queued, or taken by other pumping threads.
+		 */
+		std::atomic<std::uint32_t> m_wakes{ 0 };
+	};
+
+	/**	A background thread that pumps a deferred_reclaimer for its lifetime.
+	 */
+	class deferred_reclaim_thread final
+	{
+	public:
+		/**	Start a thread to pump a reclaimer.
+		 *	@throw std::system_error If the thread couldn't be started.
+		 *	@param reclaimer The reclaimer to pump, which must outlive this.
+		 */
+		explicit deferred_reclaim_thread(deferred_reclaimer& reclaimer)
+			: m_reclaimer{ reclaimer }
+			, m_thread{ [this]() noexcept { this->run(); } }
+		{ }
+		deferred_reclaim_thread(const deferred_reclaim_thread&) = delete;
+		deferred_reclaim_thread& operator=(const deferred_reclaim_thread&) = delete;
+		/**	Stop & join the thread after it pumps any values queued before the call.
+		 */
+		~deferred_reclaim_thread()
+		{
+			m_stop.store(true, std::memory_order_relaxed);
+			m_reclaimer.wake();
+			m_thread.join();
+		}
+
+	private:
+		void run() noexcept
+		{
+			for (;;)
+			{
+				// Read before m_stop, so that a wake by the destructor after the check isn't missed:
+				const std::uint32_t count{ m_reclaimer.wake_count() };
+				if (m_stop.load(std::memory_order_relaxed))
+				{
+					break;
+				}
+				m_reclaimer.wait(count);
+				m_reclaimer.pump();
+			}
+			m_reclaimer.pump();
+		}
+
+		deferred_reclaimer& m_reclaimer;
+		std::atomic<bool> m_stop{ false };
+		std::thread m_thread;
+	};
+
+	inline deferred_reclaimer& deferred_reclaimer::global()
+	{
+		// Neither the reclaimer nor its thread are ever destroyed. The thread waits for work until process exit.
+		static deferred_reclaimer* const instance = new deferred_reclaimer{};
+		static deferred_reclaim_thread* const background = new deferred_reclaim_thread{ *instance };
+		(void)background;
+		return *instance;
+	}
+} // namespace sh
+
+namespace sh::pointer
+{
+	/**	Allocate a control block associated with a value of type T using a given allocator, the destruction of which
+	 *	is deferred to a deferred_reclaimer.
+	 *	@tparam T The value type.
+	 *	@tparam Alloc The allocator type.
+	 *	@detail The last shared reference queues the value rather than destroying it, and its storage is deallocated
+	 *		by whichever of the reclaimer & the last weak reference finishes second.
+	 */
+	template <
+		typename T,
+		typename Alloc
+	>
+		requires (false == std::is_array_v<T>)
+	class deferred_value_convertible_to_control final
+	{
+	private:
+		using element_type = T;
+		static_assert(alignof(element_type) <= max_alignment,
+			"element_type has extended alignment, beyond that which sh::shared_ptr expects. See sh::pointer::max_alignment.");
+
+		using allocator_traits = std::allocator_traits<Alloc>;
+		using value_allocator_traits = typename allocator_traits::template rebind_traits<element_type>;
+		using value_allocator = typename value_allocator_traits::allocator_type;
+
+		/**	A convertible control block with an allocator, reclaimer, queue entry & storage space for an associated value.
+		 */
+		struct storage_type final
+		{
+			/**	Construct storage for an element_type.
+			 *	@param alloc The allocator to be used for constructing and destroying the value.
+			 *	@param reclaimer The reclaimer to which the value's destruction is deferred.
+			 */
+			storage_type(value_allocator&& alloc, deferred_reclaimer& reclaimer) noexcept
+				: m_ctrl{ control::shared_one, deferred_value_convertible_to_control::operations() }
+				, m_alloc{ std::move(alloc) }
+				, m_reclaimer{ &reclaimer }
+				, m_node{ nullptr, &deferred_value_convertible_to_control::reclaim }
+			{
+				static_assert(std::is_nothrow_move_constructible_v<value_allocator>,
+					"Exceptions from value_allocator move contructor aren't expected.");
+				static_assert(is_pointer_interconvertible_with_class(&std::remove_pointer_t<decltype(this)>::m_ctrl),
+					"reinterpret_cast from convertible_control to storage_type must be valid.");
+				static_assert(offsetof(storage_type, m_value) - offsetof(storage_type, m_ctrl) == sizeof(convertible_control),
+					"convert_value_to_control only valid if m_ctrl to m_value offset is sizeof(convertible_control).");
+			}
+
+			/**	Control block convertible to and from m_value.
+			 *	@note Must be first member of storage_type as reinterpret_cast is used to convert from convertible_control.
+			 */
+			convertible_control m_ctrl;
+
+			/**	Storage space to be used for the construction of element_type.
+			 *	@note Must immediately follow and be similarly aligned to convertible_control for conversion to work.
+			 */
+			alignas(convertible_control) std::byte m_value[sizeof(element_type)];
+
+			/**	Allocator used for constructing and destroying value.
+			 */
+			SH_POINTER_NO_UNIQUE_ADDRESS value_allocator m_alloc;
+
+			/**	The reclaimer to which the value's destruction is deferred.
+			 */
+			deferred_reclaimer* const m_reclaimer;
+
+			/**	The entry queued to m_reclaimer upon release of the last shared reference.
+			 */
+			deferred_node m_node;
+
+			/**	Incremented once the value is destroyed & once deallocation is requested. Whichever is second deallocates.
+			 */
+			std::atomic<std::uint8_t> m_rendezvous{ 0 };
+		};
+
+		using storage_allocator_traits = typename allocator_traits::template rebind_traits<storage_type>;
+		using storage_allocator = typename storage_allocator_traits::allocator_type;
+
+		/**	Deallocate storage if the other of the value's destruction & the request for deallocation has occurred.
+		 *	@param storage The storage.
+		 */
+		static void arrive(storage_type* const storage) noexcept
+		{
+			if (storage->m_rendezvous.fetch_add(1, std::memory_order_acq_rel) == 0)
+			{
+				return;
+			}
+			// Move this allocator out of storage before destroying & deleting it.
+			storage_allocator storage_alloc{ std::move(storage->m_alloc) };
+			storage_allocator_traits::destroy(storage_alloc, storage);
+			storage_allocator_traits::deallocate(storage_alloc, storage, 1);
+		}
+		/**	Destroy a queued value, called by deferred_reclaimer::pump.
+		 *	@param node The queue entry within storage_type.
+		 */
+		static void reclaim(deferred_node* const node) noexcept
+		{
+			storage_type* const storage = backward_offset_cast<storage_type*>(
+				node,
+				std::integral_constant<std::size_t, offsetof(storage_type, m_node)>{});
+			element_type& value = convert_control_to_value<element_type&>(storage->m_ctrl);
+			value_allocator_traits::destroy(storage->m_alloc, std::addressof(value));
+			arrive(storage);
+		}
+
+#if SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+		/**	For debug validation & profiling, return a pointer to a static string identifying this class.
+		 *	@return A pointer to a static string identifying this class.
+		 */
+		static const char* origin() noexcept
+		{
+			static const char* const instance = typeid(deferred_value_convertible_to_control).name();
+			return instance;
+		}
+#endif // SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+
+		/**	Return a reference to a static control_operations structure.
+		 *	@return A reference to a static control_operations structure.
+		 */
+		static const control_operations& operations() noexcept
+		{
+			static constexpr auto destruct = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_destruct(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+				storage_type& storage = reinterpret_cast<storage_type&>(static_cast<convertible_control&>(*ctrl));
+				storage.m_reclaimer->enqueue(storage.m_node);
+			};
+			static constexpr auto deallocate = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_deallocate(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+				arrive(reinterpret_cast<storage_type*>(static_cast<convertible_control*>(ctrl)));
+			};
+			static const control_operations instance{
+#ifdef __cpp_designated_initializers
+				.m_destruct =
+#endif // __cpp_designated_initializers
+				/* destruct */ destruct,
+#ifdef __cpp_designated_initializers
+				.m_deallocate =
+#endif // __cpp_designated_initializers
+				/* deallocate */ deallocate,
+#ifdef __cpp_designated_initializers
+				.m_destruct_deallocate =
+#endif // __cpp_designated_initializers
+				/* destruct_deallocate */
+				[](control* const ctrl) noexcept -> void
+				{
+					destruct(ctrl);
+					deallocate(ctrl);
+				},
+#ifdef __cpp_designated_initializers
+				.m_get_deleter =
+#endif // __cpp_designated_initializers
+				/* get_deleter */ nullptr,
+#if SH_POINTER_PROFILE
+#ifdef __cpp_designated_initializers
+				.m_get_origin =
+#endif // __cpp_designated_initializers
+				/* get_origin */ origin,
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_BIASED_COUNT
+#ifdef __cpp_designated_initializers
+				.m_bias_offset =
+#endif // __cpp_designated_initializers
+				/* bias_offset */ 0,
+#endif // SH_POINTER_BIASED_COUNT
+			};
+			return instance;
+		}
+
+	public:
+		/**	Allocate a control block associated with a value using a given allocator, the latter constructed with the given arguments.
+		 *	@throw May throw std::bad_alloc or other exceptions during allocation & construction.
+		 *	@tparam Args The argument types to pass to value's constructor T::T.
+		 *	@param reclaimer The reclaimer to which the value's destruction is deferred.
+		 *	@param alloc The allocator.
+		 *	@param args The arguments to pass to value's constructor T::T.
+		 *	@return The pointer to the control value. Use convert_value_to_control to access the associated control block.
+		 */
+		template <typename... Args>
+		static element_type* allocate(deferred_reclaimer& reclaimer, const Alloc& alloc, Args&&... args)
+		{
+			storage_allocator storage_alloc{ alloc };
+			storage_type* const storage = storage_allocator_traits::allocate(storage_alloc, 1);
+			storage_allocator_traits::construct(storage_alloc, storage, value_allocator{ alloc }, reclaimer);
+
+			element_type* const value = reinterpret_cast<element_type*>(&storage->m_value);
+			try
+			{
+				value_allocator_traits::construct(storage->m_alloc, value, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				storage_allocator_traits::destroy(storage_alloc, storage);
+				storage_allocator_traits::deallocate(storage_alloc, storage, 1);
+				throw;
+			}
+			static_assert(false == std::is_convertible_v<element_type*, control_from_this*>,
+				"enable_shared_from_this isn't supported by deferred values.");
+#if SH_POINTER_DEBUG_SHARED_PTR
+			storage->m_ctrl.validate_set_origin(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+			return value;
+		}
+	};
+} // namespace sh::pointer
+
+namespace sh
+{
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T using the supplied allocator, the
+	 *	destruction of which is deferred to a reclaimer.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Alloc The allocator type to use for construction and destruction.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param reclaimer The reclaimer to which destruction is deferred. Must outlive the returned value & all copies
+	 *		of it, & be pumped for the value to be destroyed.
+	 *	@param alloc The allocator to use.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename Alloc,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>
+			&& alignof(T) <= pointer::max_alignment)
+	shared_ptr<T> allocate_shared_deferred(deferred_reclaimer& reclaimer, const Alloc& alloc, Args&&... args)
+	{
+		using element_type = std::remove_const_t<T>;
+		using origin_type = pointer::deferred_value_convertible_to_control<element_type, Alloc>;
+		return shared_ptr<T>{
+			origin_type::allocate(
+				reclaimer,
+				alloc,
+				std::forward<Args>(args)...
+			)
+		};
+	}
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T, the destruction of which is deferred to
+	 *	deferred_reclaimer::global() & performed by a background thread.
+	 *	@throw May throw std::bad_alloc, std::system_error if the background thread couldn't be started, or other
+	 *		exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>
+			&& alignof(T) <= pointer::max_alignment)
+	shared_ptr<T> make_shared_deferred(Args&&... args)
+	{
+		return sh::allocate_shared_deferred<T>(
+			deferred_reclaimer::global(),
+			pointer::default_allocator<std::remove_const_t<T>>{},
+			std::forward<Args>(args)...
+		);
+	}
+} // namespace sh
+
+#endif
@@ -0,0 +1,479 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__HAZARD_POINTER_HPP
+#define INC_SH__HAZARD_POINTER_HPP
+
+/**	@file
+ *	This file declares sh::pointer::hazard_domain and sh::hazard_guard, which
+ *	allow borrowing the value behind a std::atomic<sh::shared_ptr> without
+ *	modifying its reference count:
+ *
+ *		const auto guard = sh::pointer::hazard_domain::global().protect(atomic);
+ *		if (guard) { use(*guard); }
+ *
+ *	A guard publishes the control block it borrows as a hazard. Once the
+ *	first guard has been taken, writers (store, exchange, compare_exchange,
+ *	and destruction) check for hazards upon replacing a control block and
+ *	defer releasing one reference to it until the hazard is withdrawn. Until
+ *	then, writers skip hazard checks (see sh::pointer::replaced_hooks).
+ *	Borrowing costs a store to a per-thread hazard record and a reload of the
+ *	atomic rather than contended increment and decrement of the control block.
+ */
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "atomic_shared_ptr.hpp"
+#include "shared_ptr.hpp"
+
+namespace sh
+{
+	template <typename T> class hazard_guard;
+} // namespace sh
+
+namespace sh::pointer
+{
+	/**	The domain of hazard pointers consulted by std::atomic<sh::shared_ptr> writers.
+	 *	@detail A single global domain exists, as every atomic must consult each domain that may borrow from it.
+	 *		Hazard records are allocated per thread upon first use, reused after thread exit, and released with
+	 *		the domain at program exit.
+	 */
+	class hazard_domain final
+	{
+	public:
+		hazard_domain(const hazard_domain&) = delete;
+		hazard_domain& operator=(const hazard_domain&) = delete;
+
+		/**	Return the global hazard_domain.
+		 *	@return A reference to the instance, which is never destroyed such that atomics with static storage
+		 *		duration may safely consult it during their own destruction.
+		 */
+		static hazard_domain& global() noexcept
+		{
+			static hazard_domain* const instance = new hazard_domain{};
+			return *instance;
+		}
+
+		/**	Borrow the value held by an atomic shared_ptr until the returned guard is destroyed or reset.
+		 *	@param source The atomic from which to borrow.
+		 *	@return A guard referring to the value that source held at some point during this call. May be empty.
+		 */
+		template <typename T>
+		[[nodiscard]] hazard_guard<T> protect(const std::atomic<::sh::shared_ptr<T>>& source);
+
+		/**	Retain a control block replaced within an atomic shared_ptr, deferring one additional reference if
+		 *	protected by a hazard. Installed into replaced_hooks by the first protect.
+		 *	@param ctrl The non-null control block that was replaced, to which the caller holds a reference.
+		 */
+		void retain(control* const ctrl) noexcept
+		{
+			if (this->is_protected(ctrl))
+			{
+				ctrl->shared_inc();
+				this->defer(ctrl);
+			}
+		}
+		/**	Release deferred references that are no longer protected by a hazard.
+		 */
+		void reclaim() noexcept
+		{
+			std::vector<control*> pending;
+			{
+				const std::lock_guard<std::mutex> lock{ m_retired_mutex };
+				pending.swap(m_retired);
+				m_retired_count.store(0, std::memory_order_seq_cst);
+			}
+			// Release without holding the lock, as destruction of a value may
+			// replace others within atomics & so defer more:
+			std::size_t kept = 0;
+			for (control* const ctrl : pending)
+			{
+				if (this->is_protected(ctrl))
+				{
+					pending[kept++] = ctrl;
+				}
+				else
+				{
+					ctrl->shared_dec();
+				}
+			}
+			pending.resize(kept);
+			if (pending.empty())
+			{
+				return;
+			}
+			bool deferred = false;
+			{
+				const std::lock_guard<std::mutex> lock{ m_retired_mutex };
+				try
+				{
+					if (m_retired.empty())
+					{
+						m_retired.swap(pending);
+					}
+					else
+					{
+						m_retired.insert(m_retired.end(), pending.begin(), pending.end());
+						pending.clear();
+					}
+					m_retired_count.store(m_retired.size(), std::memory_order_seq_cst);
+					deferred = true;
+				}
+				catch (const std::bad_alloc&)
+				{
+				}
+			}
+			if (deferred == false)
+			{
+				for (control* const ctrl : pending)
+				{
+					this->release_when_unprotected(ctrl);
+				}
+				return;
+			}
+			// Hazards withdrawn while pending was held here may not have
+			// found anything to reclaim, so check again:
+			bool unprotected = false;
+			{
+				const std::lock_guard<std::mutex> lock{ m_retired_mutex };
+				for (const control* const ctrl : m_retired)
+				{
+					if (this->is_protected(ctrl) == false)
+					{
+						unprotected = true;
+						break;
+					}
+				}
+			}
+			if (unprotected)
+			{
+				this->reclaim();
+			}
+		}
+
+	private:
+		template <typename T> friend class ::sh::hazard_guard;
+
+		/**	A published hazard, owned by one thread at a time.
+		 */
+		struct record final
+		{
+			/**	The protected control block or nullptr.
+			 */
+			std::atomic<const control*> m_hazard{ nullptr };
+			/**	True while owned by a thread.
+			 */
+			std::atomic<bool> m_active{ true };
+			/**	The next record in the domain. Records are never removed before the domain's destruction.
+			 */
+			record* m_next{ nullptr };
+		};
+
+		/**	A record cached by a thread between guards, deactivated at thread exit for reuse by other threads.
+		 */
+		struct thread_cache final
+		{
+			~thread_cache()
+			{
+				if (record* const cached = std::exchange(m_record, nullptr))
+				{
+					cached->m_active.store(false, std::memory_order_release);
+				}
+				get_thread_cache_destroyed() = true;
+			}
+			record* m_record{ nullptr };
+		};
+
+		hazard_domain() noexcept = default;
+		~hazard_domain() = default;
+
+		/**	The hook installed into replaced_hooks.
+		 */
+		static void retain_replaced(control* const ctrl) noexcept
+		{
+			global().retain(ctrl);
+		}
+		/**	Return the calling thread's thread_cache.
+		 *	@return The cache, or nullptr if destroyed during thread exit, after which each guard acquires & releases
+		 *		its own record.
+		 */
+		static thread_cache* get_thread_cache() noexcept
+		{
+			if (get_thread_cache_destroyed())
+			{
+				return nullptr;
+			}
+			thread_local thread_cache instance;
+			return &instance;
+		}
+		/**	Return whether the calling thread's thread_cache has been destroyed.
+		 *	@return The flag, which is trivially destructible & so safe to use throughout thread exit.
+		 */
+		static bool& get_thread_cache_destroyed() noexcept
+		{
+			thread_local bool destroyed{ false };
+			return destroyed;
+		}
+
+		/**	Acquire a record for exclusive use by the calling thread.
+		 *	@return A record with no hazard published.
+		 */
+		record* acquire_record()
+		{
+			if (thread_cache* const cache = get_thread_cache())
+			{
+				if (record* const cached = std::exchange(cache->m_record, nullptr))
+				{
+					return cached;
+				}
+			}
+			for (record* candidate = m_records.load(std::memory_order_acquire); candidate; candidate = candidate->m_next)
+			{
+				bool active = false;
+				if (candidate->m_active.load(std::memory_order_relaxed) == false
+					&& candidate->m_active.compare_exchange_strong(active, true, std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					return candidate;
+				}
+			}
+			record* const created = new record{};
+			record* head = m_records.load(std::memory_order_relaxed);
+			do
+			{
+				created->m_next = head;
+			} while (m_records.compare_exchange_weak(head, created, std::memory_order_seq_cst, std::memory_order_relaxed) == false);
+			return created;
+		}
+		/**	Withdraw a record's hazard & return it for reuse, then reclaim deferred references if there are any.
+		 *	@param released The record, which must have been acquired by the calling thread.
+		 */
+		void release_record(record* const released) noexcept
+		{
+			released->m_hazard.store(nullptr, std::memory_order_seq_cst);
+			thread_cache* const cache = get_thread_cache();
+			if (cache && cache->m_record == nullptr)
+			{
+				cache->m_record = released;
+			}
+			else
+			{
+				released->m_active.store(false, std::memory_order_release);
+			}
+			if (m_retired_count.load(std::memory_order_seq_cst) != 0)
+			{
+				this->reclaim();
+			}
+		}
+		/**	Return true if a hazard protects a control block.
+		 *	@param ctrl The control block to check. As atomics replace control blocks sequentially consistent, any
+		 *		reader that found ctrl still installed after publishing its hazard will be seen.
+		 */
+		bool is_protected(const control* const ctrl) const noexcept
+		{
+			for (const record* candidate = m_records.load(std::memory_order_seq_cst); candidate; candidate = candidate->m_next)
+			{
+				if (candidate->m_hazard.load(std::memory_order_seq_cst) == ctrl)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/**	Defer releasing one shared reference to a control block until it is no longer protected.
+		 *	@param ctrl The control block.
+		 */
+		void defer(control* const ctrl) noexcept
+		{
+			bool deferred = false;
+			{
+				const std::lock_guard<std::mutex> lock{ m_retired_mutex };
+				try
+				{
+					m_retired.push_back(ctrl);
+					m_retired_count.store(m_retired.size(), std::memory_order_seq_cst);
+					deferred = true;
+				}
+				catch (const std::bad_alloc&)
+				{
+				}
+			}
+			if (deferred)
+			{
+				// The hazard may have been withdrawn before m_retired_count was
+				// updated, so its guard may not have reclaimed:
+				this->reclaim();
+				return;
+			}
+			// Without memory to defer, wait for the hazard to be withdrawn:
+			this->release_when_unprotected(ctrl);
+		}
+		/**	Wait until a control block is no longer protected by a hazard, then release one shared reference to it.
+		 *	@param ctrl The control block.
+		 */
+		void release_when_unprotected(control* const ctrl) noexcept
+		{
+			while (this->is_protected(ctrl))
+			{
+				std::this_thread::yield();
+			}
+			ctrl->shared_dec();
+		}
+
+		/**	Singly linked list of records, pushed to the front.
+		 */
+		std::atomic<record*> m_records{ nullptr };
+		/**	Control blocks with one deferred shared reference each.
+		 */
+		std::vector<control*> m_retired;
+		std::mutex m_retired_mutex;
+		/**	The size of m_retired, readable without m_retired_mutex.
+		 */
+		std::atomic<std::size_t> m_retired_count{ 0 };
+	};
+
+} // namespace sh::pointer
+
+namespace sh
+{
+	/**	A scoped borrow of a value held by a std::atomic<sh::shared_ptr>, returned by hazard_domain::protect.
+	 *	@tparam T The type of std::atomic<sh::shared_ptr<T>> from which the value was borrowed.
+	 *	@note The value remains valid until destruction or reset, but no longer than the calling thread. Guards
+	 *		may not be passed between threads.
+	 */
+	template <typename T>
+	class hazard_guard final
+	{
+	public:
+		using element_type = typename shared_ptr<T>::element_type;
+
+		constexpr hazard_guard() noexcept = default;
+		hazard_guard(hazard_guard&& other) noexcept
+			: m_record{ std::exchange(other.m_record, nullptr) }
+			, m_value{ std::exchange(other.m_value, nullptr) }
+		{ }
+		hazard_guard& operator=(hazard_guard&& other) noexcept
+		{
+			if (this != &other)
+			{
+				this->reset();
+				m_record = std::exchange(other.m_record, nullptr);
+				m_value = std::exchange(other.m_value, nullptr);
+			}
+			return *this;
+		}
+		~hazard_guard()
+		{
+			this->reset();
+		}
+		hazard_guard(const hazard_guard&) = delete;
+		hazard_guard& operator=(const hazard_guard&) = delete;
+
+		/**	Withdraw the hazard, ending the borrow.
+		 */
+		void reset() noexcept
+		{
+			if (m_record)
+			{
+				pointer::hazard_domain::global().release_record(std::exchange(m_record, nullptr));
+				m_value = nullptr;
+			}
+		}
+		element_type* get() const noexcept
+		{
+			return m_value;
+		}
+		element_type& operator*() const noexcept
+		{
+			SH_POINTER_ASSERT(m_value != nullptr, "Didn't expect to dereference an empty hazard_guard.");
+			return *m_value;
+		}
+		element_type* operator->() const noexcept
+		{
+			SH_POINTER_ASSERT(m_value != nullptr, "Didn't expect to dereference an empty hazard_guard.");
+			return m_value;
+		}
+		explicit operator bool() const noexcept
+		{
+			return m_value != nullptr;
+		}
+
+	private:
+		friend class pointer::hazard_domain;
+
+		hazard_guard(pointer::hazard_domain::record* const protecting, element_type* const value) noexcept
+			: m_record{ protecting }
+			, m_value{ value }
+		{ }
+
+		/**	The record publishing the hazard, or nullptr if empty.
+		 */
+		pointer::hazard_domain::record* m_record{ nullptr };
+		/**	The borrowed value, or nullptr if empty.
+		 */
+		element_type* m_value{ nullptr };
+	};
+
+	template <typename T>
+	hazard_guard<T> pointer::hazard_domain::protect(const std::atomic<::sh::shared_ptr<T>>& source)
+	{
+		using element_type = typename hazard_guard<T>::element_type;
+		// Install before publishing, such that writers that don't find the hook replaced ctrl before we found it:
+		replaced_hooks::install(&hazard_domain::retain_replaced);
+		record* const protecting = this->acquire_record();
+		convertible_control* ctrl = source.peek(std::memory_order_relaxed);
+		for (;;)
+		{
+			// Publish, then check ctrl is still installed. If so, any writer
+			// replacing it will find the hazard.
+			protecting->m_hazard.store(ctrl, std::memory_order_seq_cst);
+			convertible_control* const current = source.peek(std::memory_order_seq_cst);
+			if (current == ctrl)
+			{
+				break;
+			}
+			ctrl = current;
+		}
+		if (ctrl == nullptr)
+		{
+			this->release_record(protecting);
+			return hazard_guard<T>{};
+		}
+		return hazard_guard<T>{ protecting, convert_control_to_value<element_type*>(ctrl) };
+	}
+} // namespace sh
+
+#endif
@@ -0,0 +1,511 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__LOCAL_SHARED_PTR_HPP
+#define INC_SH__LOCAL_SHARED_PTR_HPP
+
+/**	@file
+ *	This file declares sh::local_shared_ptr, sh::local_weak_ptr, and related
+ *	functions:
+ *		* allocate_local_shared
+ *		* make_local_shared
+ *		* owner_less
+ *		* std::hash<sh::local_shared_ptr>
+ *
+ *	These "local" varieties of sh::shared_ptr/weak_ptr share its single pointer
+ *	width & storage layout but count references without atomic
+ *	read-modify-write operations. Every copy & weak reference to a value must
+ *	be created, used, and destroyed by a single thread. In debug builds (see
+ *	SH_POINTER_DEBUG_SHARED_PTR), counting from any other thread asserts.
+ *
+ *	Conversion to & from sh::shared_ptr is intentionally unavailable, as is
+ *	use with sh::enable_shared_from_this, as either would allow a locally
+ *	counted control block to be shared across threads.
+ */
+
+#include "shared_ptr.hpp"
+// pointer_traits.hpp & pointer.hpp included by shared_ptr.hpp
+
+namespace sh
+{
+	template <typename T> class local_shared_ptr;
+	template <typename T> class local_weak_ptr;
+
+	/**	A reference counting owner of allocated data like sh::shared_ptr that counts references without atomic operations for use by a single thread.
+	 */
+	template <typename T>
+	class local_shared_ptr
+	{
+	public:
+		static_assert(false == std::is_array_v<T>, "sh::local_shared_ptr doesn't support arrays.");
+
+		using element_type = T;
+		using weak_type = local_weak_ptr<T>;
+
+		constexpr local_shared_ptr() noexcept
+			: m_value{ nullptr }
+		{ }
+		constexpr local_shared_ptr(std::nullptr_t) noexcept
+			: m_value{ nullptr }
+		{ }
+		local_shared_ptr(const local_shared_ptr<T>& other) noexcept
+			: m_value{ other.m_value }
+		{
+			increment(m_value);
+		}
+		local_shared_ptr(local_shared_ptr<T>&& other) noexcept
+			: m_value{ std::exchange(other.m_value, nullptr) }
+		{ }
+		~local_shared_ptr()
+		{
+			decrement(m_value);
+		}
+
+		local_shared_ptr& operator=(const local_shared_ptr<T>& other) noexcept
+		{
+			increment(other.m_value);
+			decrement(m_value);
+			m_value = other.m_value;
+			return *this;
+		}
+		local_shared_ptr& operator=(local_shared_ptr<T>&& other) noexcept
+		{
+			if (this != &other)
+			{
+				element_type* const value = std::exchange(other.m_value, nullptr);
+				this->decrement(m_value);
+				m_value = value;
+			}
+			return *this;
+		}
+
+		void reset() noexcept
+		{
+			decrement(std::exchange(m_value, nullptr));
+		}
+		void swap(local_shared_ptr& other) noexcept
+		{
+			std::swap(m_value, other.m_value);
+		}
+
+		element_type* get() const noexcept
+		{
+			return m_value;
+		}
+		element_type& operator*() const noexcept
+		{
+			SH_POINTER_ASSERT(m_value != nullptr, "Dereferencing nullptr local_shared_ptr.");
+			return *m_value;
+		}
+		element_type* operator->() const noexcept
+		{
+			SH_POINTER_ASSERT(m_value != nullptr, "Dereferencing nullptr local_shared_ptr.");
+			return m_value;
+		}
+		pointer::use_count_t use_count() const noexcept
+		{
+			return m_value ? pointer::convert_value_to_control(*m_value).get_shared_count() : pointer::use_count_t{ 0 };
+		}
+		explicit constexpr operator bool() const noexcept
+		{
+			return m_value != nullptr;
+		}
+		template <typename Y>
+		bool owner_before(const local_shared_ptr<Y>& other) const noexcept
+		{
+			// As with sh::shared_ptr, control blocks are at a fixed offset
+			// from values, so values order owners.
+			return m_value < other.m_value;
+		}
+		template <typename Y>
+		bool owner_before(const local_weak_ptr<Y>& other) const noexcept
+		{
+			return pointer::convert_value_to_control(m_value) < other.m_ctrl;
+		}
+
+		// implicit conversion
+		template <typename U>
+			requires (std::is_convertible_v<U*, T*>
+				&& is_pointer_interconvertible_v<U, T>)
+		local_shared_ptr(const local_shared_ptr<U>& other) noexcept
+			: m_value{ other.get() }
+		{
+			increment(m_value);
+		}
+		template <typename U>
+			requires (std::is_convertible_v<U*, T*>
+				&& is_pointer_interconvertible_v<U, T>)
+		local_shared_ptr(local_shared_ptr<U>&& other) noexcept
+			: m_value{ std::exchange(other.m_value, nullptr) }
+		{ }
+		template <typename U>
+			requires (std::is_convertible_v<U*, T*>
+				&& is_pointer_interconvertible_v<U, T>)
+		local_shared_ptr& operator=(const local_shared_ptr<U>& other) noexcept
+		{
+			increment(other.get());
+			decrement(m_value);
+			m_value = other.get();
+			return *this;
+		}
+		template <typename U>
+			requires (std::is_convertible_v<U*, T*>
+				&& is_pointer_interconvertible_v<U, T>)
+		local_shared_ptr& operator=(local_shared_ptr<U>&& other) noexcept
+		{
+			auto* const value = std::exchange(other.m_value, nullptr);
+			this->decrement(m_value);
+			m_value = value;
+			return *this;
+		}
+
+	private:
+		template <typename U> friend class local_shared_ptr;
+		template <typename U> friend class local_weak_ptr;
+
+		template <typename U, typename Alloc, typename... Args>
+			requires (false == std::is_array_v<U>
+				&& false == std::is_convertible_v<U*, pointer::control_from_this*>)
+		friend local_shared_ptr<U> allocate_local_shared(const Alloc& alloc, Args&&... args);
+
+		static void increment(element_type* const value) noexcept
+		{
+			if (value)
+			{
+				pointer::convert_value_to_control(*value).local_shared_inc();
+			}
+		}
+		static void decrement(element_type* const value) noexcept
+		{
+			if (value)
+			{
+				pointer::convert_value_to_control(*value).local_shared_dec();
+			}
+		}
+
+		/**	Constructor for internal use that accepts a value associated with a convertible_control that has a shared_inc that this local_shared_ptr will assume.
+		 *	@param value_with_one_ref A value associated with a convertible_control with a shared_inc to assume.
+		 */
+		explicit local_shared_ptr(element_type* const value_with_one_ref) noexcept
+			: m_value{ value_with_one_ref }
+		{ }
+
+		element_type* m_value;
+	};
+
+	/**	A reference counting weak owner of allocated data like sh::weak_ptr that counts references without atomic operations for use by a single thread.
+	 */
+	template <typename T>
+	class local_weak_ptr
+	{
+	public:
+		static_assert(false == std::is_array_v<T>, "sh::local_weak_ptr doesn't support arrays.");
+
+		using element_type = T;
+
+		constexpr local_weak_ptr() noexcept
+			: m_ctrl{ nullptr }
+		{ }
+		local_weak_ptr(const local_weak_ptr<T>& other) noexcept
+			: m_ctrl{ other.m_ctrl }
+		{
+			increment(m_ctrl);
+		}
+		local_weak_ptr(local_weak_ptr<T>&& other) noexcept
+			: m_ctrl{ std::exchange(other.m_ctrl, nullptr) }
+		{ }
+		local_weak_ptr(const local_shared_ptr<T>& other) noexcept
+			: m_ctrl{ pointer::convert_value_to_control(other.get()) }
+		{
+			increment(m_ctrl);
+		}
+		~local_weak_ptr()
+		{
+			decrement(m_ctrl);
+		}
+
+		local_weak_ptr& operator=(const local_weak_ptr<T>& other) noexcept
+		{
+			increment(other.m_ctrl);
+			decrement(m_ctrl);
+			m_ctrl = other.m_ctrl;
+			return *this;
+		}
+		local_weak_ptr& operator=(local_weak_ptr<T>&& other) noexcept
+		{
+			if (this != &other)
+			{
+				pointer::convertible_control* const ctrl = std::exchange(other.m_ctrl, nullptr);
+				this->decrement(m_ctrl);
+				m_ctrl = ctrl;
+			}
+			return *this;
+		}
+		local_weak_ptr& operator=(const local_shared_ptr<T>& other) noexcept
+		{
+			pointer::convertible_control* const ctrl = pointer::convert_value_to_control(other.get());
+			increment(ctrl);
+			decrement(m_ctrl);
+			m_ctrl = ctrl;
+			return *this;
+		}
+
+		void reset() noexcept
+		{
+			decrement(std::exchange(m_ctrl, nullptr));
+		}
+		void swap(local_weak_ptr& other) noexcept
+		{
+			using std::swap;
+			swap(m_ctrl, other.m_ctrl);
+		}
+		pointer::use_count_t use_count() const noexcept
+		{
+			return m_ctrl ? m_ctrl->get_shared_count() : pointer::use_count_t{ 0 };
+		}
+		local_shared_ptr<T> lock() const noexcept
+		{
+			return m_ctrl
+				&& m_ctrl->local_shared_inc_if_nonzero() == pointer::control::shared_inc_if_nonzero_result::added_shared_inc
+				? local_shared_ptr<T>{ std::addressof(pointer::convert_control_to_value<element_type&>(*m_ctrl)) }
+				: local_shared_ptr<T>{ nullptr };
+		}
+		bool expired() const noexcept
+		{
+			return m_ctrl == nullptr || m_ctrl->get_shared_count() == 0;
+		}
+		template <typename Y>
+		bool owner_before(const local_shared_ptr<Y>& other) const noexcept
+		{
+			return m_ctrl < pointer::convert_value_to_control(other.m_value);
+		}
+		template <typename Y>
+		bool owner_before(const local_weak_ptr<Y>& other) const noexcept
+		{
+			return m_ctrl < other.m_ctrl;
+		}
+
+		// implicit conversion from local_weak_ptr
+		template <typename U>
+			requires (std::is_convertible_v<U*, T*>
+				&& is_pointer_interconvertible_v<U, T>)
+		local_weak_ptr(const local_weak_ptr<U>& other) noexcept
+			: m_ctrl{ other.m_ctrl }
+		{
+			increment(m_ctrl);
+		}
+		template <typename U>
+			requires (std::is_convertible_v<U*, T*>
+				&& is_pointer_interconvertible_v<U, T>)
+		local_weak_ptr(local_weak_ptr<U>&& other) noexcept
+			: m_ctrl{ std::exchange(other.m_ctrl, nullptr) }
+		{ }
+
+		// implicit conversion from local_shared_ptr
+		template <typename U>
+			requires (std::is_convertible_v<U*, T*>
+				&& is_pointer_interconvertible_v<U, T>)
+		local_weak_ptr(const local_shared_ptr<U>& other) noexcept
+			: m_ctrl{ pointer::convert_value_to_control(other.get()) }
+		{
+			static_assert(false == pointer::is_weak_free_v<U>, "sh::local_weak_ptr can't reference weak-free types.");
+			increment(m_ctrl);
+		}
+
+	private:
+		template <typename U> friend class local_shared_ptr;
+		template <typename U> friend class local_weak_ptr;
+
+		static void increment(pointer::convertible_control* const ctrl) noexcept
+		{
+			static_assert(false == pointer::is_weak_free_v<element_type>, "sh::local_weak_ptr can't reference weak-free types.");
+			if (ctrl)
+			{
+				ctrl->local_weak_inc();
+			}
+		}
+		static void decrement(pointer::convertible_control* const ctrl) noexcept
+		{
+			if (ctrl)
+			{
+				ctrl->local_weak_dec();
+			}
+		}
+
+		pointer::convertible_control* m_ctrl;
+	};
+
+	/**	Constructs a sh::local_shared_ptr to own a (value initialized) element T using the supplied allocator.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Alloc The allocator type to use for construction and destruction.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param alloc The allocator to use.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::local_shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename Alloc,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>
+			&& false == std::is_convertible_v<T*, pointer::control_from_this*>)
+	local_shared_ptr<T> allocate_local_shared(const Alloc& alloc, Args&&... args)
+	{
+		using element_type = std::remove_const_t<T>;
+		using origin_type = pointer::value_convertible_to_control<element_type, Alloc>;
+		element_type* const value = origin_type::template allocate<pointer::construct_method::value_ctor>(
+			alloc,
+			std::forward<Args>(args)...
+		);
+#if SH_POINTER_DEBUG_SHARED_PTR
+		pointer::convert_value_to_control(*value).validate_set_local_thread();
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+		return local_shared_ptr<T>{ value };
+	}
+	/**	Constructs a sh::local_shared_ptr to own a (value initialized) element T.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::local_shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>
+			&& false == std::is_convertible_v<T*, pointer::control_from_this*>)
+	local_shared_ptr<T> make_local_shared(Args&&... args)
+	{
+		return sh::allocate_local_shared<T>(
+			pointer::default_allocator<std::remove_const_t<T>>{},
+			std::forward<Args>(args)...
+		);
+	}
+
+	template <typename T, typename U>
+	bool operator==(const local_shared_ptr<T>& lhs, const local_shared_ptr<U>& rhs) noexcept
+	{
+		return lhs.get() == rhs.get();
+	}
+	template <typename T>
+	bool operator==(const local_shared_ptr<T>& lhs, const std::nullptr_t) noexcept
+	{
+		return lhs.get() == nullptr;
+	}
+	template <typename U>
+	bool operator==(const std::nullptr_t, const local_shared_ptr<U>& rhs) noexcept
+	{
+		return nullptr == rhs.get();
+	}
+	template <typename T, typename U>
+	std::strong_ordering operator<=>(const local_shared_ptr<T>& lhs, const local_shared_ptr<U>& rhs) noexcept
+	{
+		return lhs.get() <=> rhs.get();
+	}
+	template <typename T>
+	std::strong_ordering operator<=>(const local_shared_ptr<T>& lhs, const std::nullptr_t) noexcept
+	{
+		return lhs.get() <=> nullptr;
+	}
+	template <typename U>
+	std::strong_ordering operator<=>(const std::nullptr_t, const local_shared_ptr<U>& rhs) noexcept
+	{
+		return nullptr <=> rhs.get();
+	}
+	template <typename T, typename U, typename V>
+	std::basic_ostream<U, V>& operator<<(std::basic_ostream<U, V>& ostr, const local_shared_ptr<T>& ptr)
+	{
+		ostr << ptr.get();
+		return ostr;
+	}
+	template <typename T>
+	void swap(local_shared_ptr<T>& lhs, local_shared_ptr<T>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+	template <typename T>
+	void swap(local_weak_ptr<T>& lhs, local_weak_ptr<T>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	template <typename T>
+	struct owner_less<local_shared_ptr<T>>
+	{
+		bool operator()(const local_shared_ptr<T>& lhs, const local_shared_ptr<T>& rhs) const noexcept
+		{
+			return lhs.owner_before(rhs);
+		}
+		bool operator()(const local_shared_ptr<T>& lhs, const local_weak_ptr<T>& rhs) const noexcept
+		{
+			return lhs.owner_before(rhs);
+		}
+		bool operator()(const local_weak_ptr<T>& lhs, const local_shared_ptr<T>& rhs) const noexcept
+		{
+			return lhs.owner_before(rhs);
+		}
+	};
+	template <typename T>
+	struct owner_less<local_weak_ptr<T>>
+	{
+		bool operator()(const local_weak_ptr<T>& lhs, const local_weak_ptr<T>& rhs) const noexcept
+		{
+			return lhs.owner_before(rhs);
+		}
+		bool operator()(const local_weak_ptr<T>& lhs, const local_shared_ptr<T>& rhs) const noexcept
+		{
+			return lhs.owner_before(rhs);
+		}
+		bool operator()(const local_shared_ptr<T>& lhs, const local_weak_ptr<T>& rhs) const noexcept
+		{
+			return lhs.owner_before(rhs);
+		}
+	};
+
+} // namespace sh
+
+namespace std
+{
+	template <typename T>
+	struct hash<sh::local_shared_ptr<T>> : std::hash<T*>
+	{
+		constexpr decltype(auto) operator()(const sh::local_shared_ptr<T>& ptr) const
+			noexcept(noexcept(std::hash<T*>::operator()(ptr.get())))
+		{
+			return this->std::hash<T*>::operator()(ptr.get());
+		}
+	};
+} // namespace std
+
+#endif
@@ -0,0 +1,130 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__PMR_SHARED_PTR_HPP
+#define INC_SH__PMR_SHARED_PTR_HPP
+
+/**	@file
+ *	This file declares sh::pmr::allocate_shared, sh::pmr::make_shared, and
+ *	their _for_overwrite counterparts, which allocate sh::shared_ptr storage
+ *	from a std::pmr::memory_resource:
+ *
+ *		std::pmr::monotonic_buffer_resource resource;
+ *		sh::shared_ptr<T> x = sh::pmr::allocate_shared<T>(&resource, args...);
+ *		sh::shared_ptr<U[]> y = sh::pmr::make_shared<U[]>(count);
+ *
+ *	Each accepts the same arguments as its counterpart in namespace sh, less
+ *	the allocator. The make_ functions use std::pmr::get_default_resource.
+ *
+ *	The std::pmr::polymorphic_allocator is stored alongside the control block
+ *	to deallocate it & so adds a pointer to each allocation. For single values,
+ *	it occupies what would otherwise be tail padding whenever the value leaves
+ *	room for it. For arrays, the elements follow the control block rounded up
+ *	only to max_alignment.
+ */
+
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "shared_ptr.hpp"
+
+namespace sh::pmr
+{
+	/**	The allocator used by sh::pmr::allocate_shared & sh::pmr::make_shared.
+	 */
+	using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+	/**	Constructs a sh::shared_ptr to own T, allocated from the given memory resource.
+	 *	@throw May throw std::bad_alloc or other exceptions from the resource or T's constructor.
+	 *	@tparam T The type of element or array to construct.
+	 *	@tparam Args The types of arguments passed to sh::allocate_shared.
+	 *	@param resource The memory resource from which to allocate. Must outlive the returned value & all copies of it.
+	 *	@param args The arguments passed to sh::allocate_shared following the allocator.
+	 *	@return A non-null sh::shared_ptr owning T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+	shared_ptr<T> allocate_shared(std::pmr::memory_resource* const resource, Args&&... args)
+	{
+		return ::sh::allocate_shared<T>(allocator_type{ resource }, std::forward<Args>(args)...);
+	}
+	/**	Constructs a sh::shared_ptr to own (default initialized) T, allocated from the given memory resource.
+	 *	@throw May throw std::bad_alloc or other exceptions from the resource or T's constructor.
+	 *	@tparam T The type of element or array to construct.
+	 *	@tparam Args The types of arguments passed to sh::allocate_shared_for_overwrite.
+	 *	@param resource The memory resource from which to allocate. Must outlive the returned value & all copies of it.
+	 *	@param args The arguments passed to sh::allocate_shared_for_overwrite following the allocator.
+	 *	@return A non-null sh::shared_ptr owning T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+	shared_ptr<T> allocate_shared_for_overwrite(std::pmr::memory_resource* const resource, Args&&... args)
+	{
+		return ::sh::allocate_shared_for_overwrite<T>(allocator_type{ resource }, std::forward<Args>(args)...);
+	}
+	/**	Constructs a sh::shared_ptr to own T, allocated from std::pmr::get_default_resource.
+	 *	@throw May throw std::bad_alloc or other exceptions from the resource or T's constructor.
+	 *	@tparam T The type of element or array to construct.
+	 *	@tparam Args The types of arguments passed to sh::allocate_shared.
+	 *	@param args The arguments passed to sh::allocate_shared following the allocator.
+	 *	@return A non-null sh::shared_ptr owning T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+	shared_ptr<T> make_shared(Args&&... args)
+	{
+		return ::sh::pmr::allocate_shared<T>(std::pmr::get_default_resource(), std::forward<Args>(args)...);
+	}
+	/**	Constructs a sh::shared_ptr to own (default initialized) T, allocated from std::pmr::get_default_resource.
+	 *	@throw May throw std::bad_alloc or other exceptions from the resource or T's constructor.
+	 *	@tparam T The type of element or array to construct.
+	 *	@tparam Args The types of arguments passed to sh::allocate_shared_for_overwrite.
+	 *	@param args The arguments passed to sh::allocate_shared_for_overwrite following the allocator.
+	 *	@return A non-null sh::shared_ptr owning T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+	shared_ptr<T> make_shared_for_overwrite(Args&&... args)
+	{
+		return ::sh::pmr::allocate_shared_for_overwrite<T>(std::pmr::get_default_resource(), std::forward<Args>(args)...);
+	}
+} // namespace sh::pmr
+
+#endif
@@ -0,0 +1,105 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2024-2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**	@file
+ *	This file is the interface of the C++20 module sh.pointer, exporting
+ *	every sh header:
+ *
+ *		import sh.pointer;
+ *		sh::shared_ptr<T> x = sh::make_shared<T>(args...);
+ *
+ *	Macros (e.g., SH_POINTER_COMPACT_CONTROL) aren't exported, so are fixed
+ *	by the definitions with which the module is built. Translation units
+ *	mustn't both import the module & include its headers.
+ *
+ *	The module is experimental: compilers' support for modules is still
+ *	incomplete, so it's built only if SH_POINTER_MODULE is enabled.
+ */
+
+module;
+
+// Standard headers are included in the global module fragment, outside of the module's purview:
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <climits>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <iosfwd>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__has_include)
+	#if __has_include(<immintrin.h>)
+		#include <immintrin.h>
+	#endif // __has_include(<immintrin.h>)
+#endif // __has_include
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif // _MSC_VER && !__clang__
+
+export module sh.pointer;
+
+// Attached to the global module, such that instantiations match those of translation units including the headers:
+export extern "C++"
+{
+#include "pointer_traits.hpp"
+#include "pointer.hpp"
+#include "not_null.hpp"
+#include "never_null.hpp"
+#include "shared_ptr.hpp"
+#include "wide_shared_ptr.hpp"
+#include "atomic_shared_ptr.hpp"
+#include "atomic_wide_shared_ptr.hpp"
+#include "local_shared_ptr.hpp"
+#include "deferred_shared.hpp"
+#include "hazard_pointer.hpp"
+#include "rcu.hpp"
+#include "recycled_shared.hpp"
+#include "sharded_shared.hpp"
+#include "pool_allocator.hpp"
+#include "shared_arena.hpp"
+#include "pmr_shared_ptr.hpp"
+}
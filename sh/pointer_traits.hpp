@@ -163,7 +163,7 @@ namespace sh
 	 *	@tparam Derived The potential derived type.
 	 */
 	template <typename Base, typename Derived>
-	constexpr bool is_virtual_base_of_v = is_virtual_base_of<Base, Derived>::value;
+	inline constexpr bool is_virtual_base_of_v = is_virtual_base_of<Base, Derived>::value;
 
 	/**	Checks if static_cast<To>(From{}) will never access memory address by the value of From{}.
 	 *	@tparam To The input's type.
@@ -183,7 +183,7 @@ namespace sh
 	 *	@tparam From The output type.
 	 */
 	template <typename To, typename From>
-	constexpr bool is_static_cast_inert_v = is_static_cast_inert<To, From>::value;
+	inline constexpr bool is_static_cast_inert_v = is_static_cast_inert<To, From>::value;
 
 	/**	Test if To* can be static_cast to From* and will never alter the underlying address (that is, reinterpret_cast would serve as well in place of static_cast). Otherwise value is false.
 	 *	@tparam From The pointed-to type of value given to static_cast.
@@ -241,7 +241,7 @@ namespace sh
 	 *	@tparam To The type requested as output from static_cast.
 	 */
 	template <typename From, typename To>
-	constexpr bool is_pointer_interconvertible_v = is_pointer_interconvertible<From, To>::value;
+	inline constexpr bool is_pointer_interconvertible_v = is_pointer_interconvertible<From, To>::value;
 
 #if __cpp_lib_is_pointer_interconvertible
 	using std::is_pointer_interconvertible_with_class;
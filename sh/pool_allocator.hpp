@@ -0,0 +1,525 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__POOL_ALLOCATOR_HPP
+#define INC_SH__POOL_ALLOCATOR_HPP
+
+/**	@file
+ *	This file declares sh::pointer::pool, sh::pointer::pool_allocator, and
+ *	sh::make_pooled_shared, which allocates sh::shared_ptr storage (control
+ *	block + value) from per-thread caches of fixed size blocks:
+ *
+ *		sh::shared_ptr<T> x = sh::make_pooled_shared<T>(args...);
+ *
+ *	Requests up to SH_POINTER_POOL_MAX_BLOCK_SIZE bytes are rounded up to a
+ *	multiple of sh::pointer::max_alignment & served from that size class.
+ *	Each thread carves blocks from chunks of SH_POINTER_POOL_CHUNK_SIZE bytes
+ *	that it owns. Blocks freed by the owning thread return to its free list
+ *	without synchronization. Blocks freed by other threads are batched per
+ *	owner, up to SH_POINTER_POOL_REMOTE_BATCH at a time, & handed back with a
+ *	single compare-exchange. Larger or over-aligned requests fall back to
+ *	std::allocator.
+ *
+ *	Chunks are never returned to the system. A thread's cache, including its
+ *	chunks & free blocks, is adopted by the next thread to need one after it
+ *	exits.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "shared_ptr.hpp"
+
+/**	The largest request, in bytes, served from a size class rather than std::allocator.
+ */
+#if !defined(SH_POINTER_POOL_MAX_BLOCK_SIZE)
+	#define SH_POINTER_POOL_MAX_BLOCK_SIZE 256
+#endif // SH_POINTER_POOL_MAX_BLOCK_SIZE
+
+/**	The size & alignment, in bytes, of each chunk from which blocks are carved. Must be a power of two.
+ */
+#if !defined(SH_POINTER_POOL_CHUNK_SIZE)
+	#define SH_POINTER_POOL_CHUNK_SIZE 65536
+#endif // SH_POINTER_POOL_CHUNK_SIZE
+
+/**	The number of blocks owned by another thread that a thread may free before handing them back.
+ */
+#if !defined(SH_POINTER_POOL_REMOTE_BATCH)
+	#define SH_POINTER_POOL_REMOTE_BATCH 32
+#endif // SH_POINTER_POOL_REMOTE_BATCH
+
+namespace sh::pointer
+{
+	/**	Size-class pool of blocks cached per thread, used by pool_allocator.
+	 *	@detail A single global pool exists. Caches are allocated per thread upon first use, reused after thread exit,
+	 *		and never freed.
+	 */
+	class pool final
+	{
+	public:
+		/**	Block sizes are multiples of, & blocks are aligned to, this many bytes.
+		 */
+		static constexpr std::size_t block_granularity{ max_alignment };
+		/**	The largest block size.
+		 */
+		static constexpr std::size_t max_block_size{ SH_POINTER_POOL_MAX_BLOCK_SIZE };
+		/**	The size & alignment of each chunk.
+		 */
+		static constexpr std::size_t chunk_size{ SH_POINTER_POOL_CHUNK_SIZE };
+		/**	The number of size classes.
+		 */
+		static constexpr std::size_t class_count{ max_block_size / block_granularity };
+
+		static_assert(max_block_size % block_granularity == 0 && max_block_size > 0,
+			"SH_POINTER_POOL_MAX_BLOCK_SIZE must be a non-zero multiple of sh::pointer::max_alignment.");
+		static_assert((chunk_size & (chunk_size - 1)) == 0,
+			"SH_POINTER_POOL_CHUNK_SIZE must be a power of two.");
+		static_assert(chunk_size >= max_block_size * 4,
+			"SH_POINTER_POOL_CHUNK_SIZE must hold several of the largest blocks.");
+
+		pool(const pool&) = delete;
+		pool& operator=(const pool&) = delete;
+
+		/**	Return the global pool.
+		 *	@return A reference to the instance, which is never destroyed such that objects with static storage
+		 *		duration may safely free blocks during their own destruction.
+		 */
+		static pool& global() noexcept
+		{
+			static pool* const instance = new pool{};
+			return *instance;
+		}
+
+		/**	Return true if a request is served from a size class.
+		 *	@param size The number of bytes requested.
+		 *	@param alignment The alignment requested.
+		 *	@return True if \p size & \p alignment fit within a block.
+		 */
+		static constexpr bool is_pooled(const std::size_t size, const std::size_t alignment) noexcept
+		{
+			return size > 0 && size <= max_block_size && alignment <= block_granularity;
+		}
+
+		/**	Allocate a block from the calling thread's cache.
+		 *	@throw std::bad_alloc If a cache or chunk couldn't be allocated.
+		 *	@param size The number of bytes requested. Must satisfy is_pooled.
+		 *	@return A block of at least \p size bytes aligned to block_granularity.
+		 */
+		[[nodiscard]] void* allocate(const std::size_t size)
+		{
+			SH_POINTER_ASSERT(is_pooled(size, 1), "Request size isn't served by sh::pointer::pool.");
+			if (cache* const local = this->local_cache())
+			{
+				return allocate(*local, size);
+			}
+			// Without a cache of its own, such as during thread exit after releasing it, borrow one for this call:
+			cache* const borrowed = this->acquire_cache();
+			if (borrowed == nullptr)
+			{
+				throw std::bad_alloc{};
+			}
+			void* block;
+			try
+			{
+				block = allocate(*borrowed, size);
+			}
+			catch (...)
+			{
+				this->release_cache(*borrowed);
+				throw;
+			}
+			this->release_cache(*borrowed);
+			return block;
+		}
+		/**	Return a block to the cache that owns it.
+		 *	@param block A block returned by allocate.
+		 *	@param size The number of bytes requested of allocate.
+		 */
+		void deallocate(void* const block, [[maybe_unused]] const std::size_t size) noexcept
+		{
+			SH_POINTER_ASSERT(is_pooled(size, 1), "Request size isn't served by sh::pointer::pool.");
+			const chunk_header& header = *reinterpret_cast<const chunk_header*>(
+				reinterpret_cast<std::uintptr_t>(block) & ~std::uintptr_t{ chunk_size - 1 });
+			SH_POINTER_ASSERT(header.m_index == class_index(size), "Block deallocated with a size other than that allocated.");
+			free_block* const freed = ::new(block) free_block{ nullptr };
+			cache* const local = this->local_cache();
+			if (local == header.m_owner)
+			{
+				size_class& sc = local->m_classes[header.m_index];
+				freed->m_next = sc.m_free;
+				sc.m_free = freed;
+			}
+			else if (local == nullptr)
+			{
+				hand_back(*header.m_owner, header.m_index, *freed, *freed);
+			}
+			else
+			{
+				remote_batch& batch = local->m_classes[header.m_index].m_pending;
+				if (batch.m_owner != header.m_owner)
+				{
+					flush(batch, header.m_index);
+					batch.m_owner = header.m_owner;
+					batch.m_tail = freed;
+				}
+				freed->m_next = batch.m_head;
+				batch.m_head = freed;
+				if (++batch.m_count >= SH_POINTER_POOL_REMOTE_BATCH)
+				{
+					flush(batch, header.m_index);
+				}
+			}
+		}
+		/**	Hand back every block the calling thread has freed on behalf of other threads but not yet handed back.
+		 */
+		void flush() noexcept
+		{
+			if (cache* const local = this->local_cache())
+			{
+				flush(*local);
+			}
+		}
+
+	private:
+		/**	A block on a free list.
+		 */
+		struct free_block final
+		{
+			free_block* m_next;
+		};
+
+		struct cache;
+
+		/**	The header at the start of each chunk, identifying the cache & size class of its blocks.
+		 */
+		struct alignas(block_granularity) chunk_header final
+		{
+			cache* const m_owner;
+			const std::size_t m_index;
+		};
+
+		/**	Blocks freed by the calling thread that are owned by another cache, pending hand back.
+		 */
+		struct remote_batch final
+		{
+			cache* m_owner{ nullptr };
+			free_block* m_head{ nullptr };
+			free_block* m_tail{ nullptr };
+			std::size_t m_count{ 0 };
+		};
+
+		/**	A cache's state for one size class.
+		 */
+		struct size_class final
+		{
+			/**	Blocks free for allocation. Accessed only by the owning thread.
+			 */
+			free_block* m_free{ nullptr };
+			/**	The remainder of the most recent chunk, from which new blocks are carved. Accessed only by the owning
+			 *	thread.
+			 */
+			std::byte* m_bump{ nullptr };
+			std::byte* m_bump_end{ nullptr };
+			/**	Blocks owned by this cache handed back by other threads.
+			 */
+			std::atomic<free_block*> m_remote{ nullptr };
+			/**	Blocks owned by other caches freed by the owning thread. Accessed only by the owning thread.
+			 */
+			remote_batch m_pending;
+		};
+
+		/**	A thread's blocks, owned by one thread at a time.
+		 */
+		struct cache final
+		{
+			/**	True while owned by a thread.
+			 */
+			std::atomic<bool> m_active{ true };
+			/**	The next cache in the pool. Caches are never removed.
+			 */
+			cache* m_next{ nullptr };
+			size_class m_classes[class_count];
+		};
+
+		/**	A cache owned by a thread, released at thread exit for reuse by other threads.
+		 */
+		struct thread_owner final
+		{
+			~thread_owner()
+			{
+				if (cache* const owned = std::exchange(m_cache, nullptr))
+				{
+					pool::global().release_cache(*owned);
+				}
+				get_owner_destroyed() = true;
+			}
+			cache* m_cache{ nullptr };
+		};
+
+		pool() noexcept = default;
+		~pool() = default;
+
+		/**	Return the size class of a request.
+		 *	@param size The number of bytes requested.
+		 *	@return The index of the smallest size class of at least \p size bytes.
+		 */
+		static constexpr std::size_t class_index(const std::size_t size) noexcept
+		{
+			return (size - 1) / block_granularity;
+		}
+
+		/**	Return whether the calling thread's thread_owner has been destroyed.
+		 *	@return The flag, which is trivially destructible & so safe to use throughout thread exit.
+		 */
+		static bool& get_owner_destroyed() noexcept
+		{
+			thread_local bool destroyed{ false };
+			return destroyed;
+		}
+		/**	Return the calling thread's cache, acquiring one upon first use.
+		 *	@return The cache or nullptr if one couldn't be allocated or the thread_owner has been destroyed during
+		 *		thread exit, after which frees are handed back to their owners.
+		 */
+		cache* local_cache() noexcept
+		{
+			if (get_owner_destroyed())
+			{
+				return nullptr;
+			}
+			thread_local thread_owner owner;
+			if (owner.m_cache == nullptr)
+			{
+				owner.m_cache = this->acquire_cache();
+			}
+			return owner.m_cache;
+		}
+		/**	Acquire a cache for exclusive use by the calling thread.
+		 *	@return A cache or nullptr if one couldn't be allocated.
+		 */
+		cache* acquire_cache() noexcept
+		{
+			for (cache* candidate = m_caches.load(std::memory_order_acquire); candidate; candidate = candidate->m_next)
+			{
+				bool active = false;
+				if (candidate->m_active.load(std::memory_order_relaxed) == false
+					&& candidate->m_active.compare_exchange_strong(active, true, std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					return candidate;
+				}
+			}
+			cache* const created = new(std::nothrow) cache{};
+			if (created == nullptr)
+			{
+				return nullptr;
+			}
+			cache* head = m_caches.load(std::memory_order_relaxed);
+			do
+			{
+				created->m_next = head;
+			} while (m_caches.compare_exchange_weak(head, created, std::memory_order_release, std::memory_order_relaxed) == false);
+			return created;
+		}
+		/**	Release a cache at thread exit or after borrowing it, handing back pending blocks owned by others.
+		 *	@param released The cache, owned by the calling thread.
+		 */
+		void release_cache(cache& released) noexcept
+		{
+			flush(released);
+			released.m_active.store(false, std::memory_order_release);
+		}
+		/**	Allocate a block from a cache.
+		 *	@throw std::bad_alloc If a chunk couldn't be allocated.
+		 *	@param local The cache, owned by the calling thread.
+		 *	@param size The number of bytes requested. Must satisfy is_pooled.
+		 *	@return A block of at least \p size bytes aligned to block_granularity.
+		 */
+		static void* allocate(cache& local, const std::size_t size)
+		{
+			const std::size_t index{ class_index(size) };
+			size_class& sc = local.m_classes[index];
+			if (sc.m_free == nullptr)
+			{
+				// Adopt everything other threads have handed back at once:
+				sc.m_free = sc.m_remote.exchange(nullptr, std::memory_order_acquire);
+			}
+			if (free_block* const block = sc.m_free)
+			{
+				sc.m_free = block->m_next;
+				return block;
+			}
+			const std::size_t block_size{ (index + 1) * block_granularity };
+			if (std::size_t(sc.m_bump_end - sc.m_bump) < block_size)
+			{
+				std::byte* const memory = static_cast<std::byte*>(::operator new(chunk_size, std::align_val_t{ chunk_size }));
+				::new(memory) chunk_header{ &local, index };
+				sc.m_bump = memory + sizeof(chunk_header);
+				sc.m_bump_end = memory + chunk_size;
+			}
+			return std::exchange(sc.m_bump, sc.m_bump + block_size);
+		}
+		/**	Hand back every pending batch of a cache.
+		 *	@param local The calling thread's cache.
+		 */
+		static void flush(cache& local) noexcept
+		{
+			for (std::size_t index = 0; index < class_count; ++index)
+			{
+				flush(local.m_classes[index].m_pending, index);
+			}
+		}
+		/**	Hand back a pending batch to its owner, leaving it empty.
+		 *	@param batch The batch.
+		 *	@param index The size class of blocks in the batch.
+		 */
+		static void flush(remote_batch& batch, const std::size_t index) noexcept
+		{
+			if (batch.m_head)
+			{
+				hand_back(*batch.m_owner, index, *batch.m_head, *batch.m_tail);
+			}
+			batch = remote_batch{};
+		}
+		/**	Push a list of blocks onto the remote list of the cache that owns them.
+		 *	@param owner The cache owning the blocks.
+		 *	@param index The size class of the blocks.
+		 *	@param head The first block in the list.
+		 *	@param tail The last block in the list.
+		 */
+		static void hand_back(cache& owner, const std::size_t index, free_block& head, free_block& tail) noexcept
+		{
+			std::atomic<free_block*>& remote = owner.m_classes[index].m_remote;
+			free_block* next = remote.load(std::memory_order_relaxed);
+			do
+			{
+				tail.m_next = next;
+			} while (remote.compare_exchange_weak(next, &head, std::memory_order_release, std::memory_order_relaxed) == false);
+		}
+
+		/**	Singly linked list of caches, pushed to the front.
+		 */
+		std::atomic<cache*> m_caches{ nullptr };
+	};
+
+	/**	An allocator drawing from the global pool, suitable for use with sh::allocate_shared.
+	 *	@tparam T The value type.
+	 */
+	template <typename T>
+	struct pool_allocator
+	{
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		template <typename U>
+		struct rebind
+		{
+			using other = pool_allocator<U>;
+		};
+
+		pool_allocator() = default;
+		pool_allocator(const pool_allocator& other) = default;
+		pool_allocator& operator=(const pool_allocator& other) = default;
+
+		template <typename U>
+		constexpr explicit pool_allocator(const pool_allocator<U>&) noexcept
+		{ }
+
+		[[nodiscard]] T* allocate(const std::size_t n)
+		{
+			if (is_pooled(n))
+			{
+				return static_cast<T*>(pool::global().allocate(n * sizeof(T)));
+			}
+			return std::allocator<T>{}.allocate(n);
+		}
+		void deallocate(T* const p, const std::size_t n) noexcept
+		{
+			if (is_pooled(n))
+			{
+				pool::global().deallocate(p, n * sizeof(T));
+			}
+			else
+			{
+				std::allocator<T>{}.deallocate(p, n);
+			}
+		}
+
+		template <typename U>
+		constexpr bool operator==(const pool_allocator<U>&) const noexcept
+		{
+			return true;
+		}
+
+	private:
+		/**	Return true if a request for \p n elements is served from the pool.
+		 */
+		static constexpr bool is_pooled(const std::size_t n) noexcept
+		{
+			return n <= pool::max_block_size / sizeof(T)
+				&& pool::is_pooled(n * sizeof(T), alignof(T));
+		}
+	};
+	/**	pool_allocator's rebinds all draw from the global pool, by size & alignment alone.
+	 */
+	template <typename U>
+	inline constexpr bool is_rebind_agnostic_v<pool_allocator<U>>{ true };
+} // namespace sh::pointer
+
+namespace sh
+{
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T, allocated from the calling thread's
+	 *	cache within sh::pointer::pool.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>)
+	shared_ptr<T> make_pooled_shared(Args&&... args)
+	{
+		return sh::allocate_shared<T>(
+			pointer::pool_allocator<std::remove_const_t<T>>{},
+			std::forward<Args>(args)...
+		);
+	}
+} // namespace sh
+
+#endif
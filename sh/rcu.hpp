@@ -0,0 +1,491 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__RCU_HPP
+#define INC_SH__RCU_HPP
+
+/**	@file
+ *	This file declares sh::pointer::rcu_domain and sh::rcu_read_guard, which allow epoch-based read-side critical
+ *	sections over std::atomic<sh::shared_ptr>:
+ *
+ *		const sh::rcu_read_guard guard;
+ *		if (const auto* value = guard.load(atomic)) { use(*value); }
+ *
+ *	Within a read section, any number of loads return raw pointers without a read-modify-write. Once the first read
+ *	section has been entered, writers (store, exchange, compare_exchange, and destruction) that replace a control block
+ *	while any thread is within a read section retire one reference to it into a per-thread list, released once every thread has passed a grace period
+ *	(i.e., left any read section that began before retirement). Reclamation is amortized over writers, with each
+ *	thread reclaiming its own list upon reaching SH_POINTER_RCU_RECLAIM_THRESHOLD entries and upon thread exit.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "atomic_shared_ptr.hpp"
+#include "shared_ptr.hpp"
+
+/**	The number of references a thread may retire before attempting to reclaim them.
+ */
+#if !defined(SH_POINTER_RCU_RECLAIM_THRESHOLD)
+	#define SH_POINTER_RCU_RECLAIM_THRESHOLD 64
+#endif // SH_POINTER_RCU_RECLAIM_THRESHOLD
+
+namespace sh
+{
+	class rcu_read_guard;
+} // namespace sh
+
+namespace sh::pointer
+{
+	/**	The domain of epoch-based read sections consulted by std::atomic<sh::shared_ptr> writers.
+	 *	@detail A single global domain exists, as every atomic must consult each domain that may borrow from it.
+	 *		Records are allocated per thread upon first use, reused after thread exit, and never freed.
+	 */
+	class rcu_domain final
+	{
+	public:
+		rcu_domain(const rcu_domain&) = delete;
+		rcu_domain& operator=(const rcu_domain&) = delete;
+
+		/**	Return the global rcu_domain.
+		 *	@return A reference to the instance, which is never destroyed such that atomics with static storage
+		 *		duration may safely consult it during their own destruction.
+		 */
+		static rcu_domain& global() noexcept
+		{
+			static rcu_domain* const instance = new rcu_domain{};
+			return *instance;
+		}
+
+		/**	Retain a control block replaced within an atomic shared_ptr if a read section may still refer to it.
+		 *	Installed into replaced_hooks by the first read section.
+		 *	@param ctrl The non-null control block that was replaced. As atomics replace control blocks sequentially
+		 *		consistent, any read section that began before replacement will be seen.
+		 */
+		void retain(control* const ctrl) noexcept
+		{
+			if (this->is_reading() == false)
+			{
+				return;
+			}
+			ctrl->shared_inc();
+			// Readers observing the advanced epoch also observe replacement:
+			const epoch_t epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+			record* const local = this->local_record();
+			if (local == nullptr)
+			{
+				this->release_after(retired{ ctrl, epoch });
+				return;
+			}
+			try
+			{
+				local->m_retired.push_back(retired{ ctrl, epoch });
+			}
+			catch (const std::bad_alloc&)
+			{
+				this->release_after(retired{ ctrl, epoch });
+				return;
+			}
+			if (local->m_retired.size() >= SH_POINTER_RCU_RECLAIM_THRESHOLD)
+			{
+				this->reclaim(*local);
+			}
+		}
+		/**	Release references retired by the calling thread whose grace periods have passed, along with any
+		 *	orphaned by exited threads. Doesn't wait.
+		 */
+		void reclaim() noexcept
+		{
+			if (record* const local = this->local_record())
+			{
+				this->reclaim(*local);
+			}
+		}
+		/**	Wait for a grace period to pass for every reference retired thus far by the calling thread, then release
+		 *	them.
+		 *	@note Must not be called within a read section.
+		 */
+		void synchronize() noexcept
+		{
+			record* const local = this->local_record();
+			SH_POINTER_ASSERT(local == nullptr || local->m_depth == 0, "Didn't expect to synchronize within a read section.");
+			const epoch_t epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+			while (this->oldest_reader() < epoch)
+			{
+				std::this_thread::yield();
+			}
+			if (local)
+			{
+				this->reclaim(*local);
+			}
+		}
+
+	private:
+		friend class ::sh::rcu_read_guard;
+
+		using epoch_t = std::uint64_t;
+
+		/**	A reference to a control block released once every read section has begun at or after m_epoch.
+		 */
+		struct retired final
+		{
+			control* m_ctrl;
+			epoch_t m_epoch;
+		};
+
+		/**	A thread's read section state & retired references, owned by one thread at a time.
+		 */
+		struct record final
+		{
+			/**	The epoch upon entering the outermost read section, or zero if not within one.
+			 */
+			std::atomic<epoch_t> m_epoch{ 0 };
+			/**	True while owned by a thread.
+			 */
+			std::atomic<bool> m_active{ true };
+			/**	The next record in the domain. Records are never removed.
+			 */
+			record* m_next{ nullptr };
+			/**	The depth of nested read sections. Accessed only by the owning thread.
+			 */
+			std::uint32_t m_depth{ 0 };
+			/**	References retired by the owning thread. Accessed only by the owning thread.
+			 */
+			std::vector<retired> m_retired;
+		};
+
+		/**	A record owned by a thread, released at thread exit for reuse by other threads.
+		 */
+		struct thread_owner final
+		{
+			~thread_owner()
+			{
+				if (record* const owned = std::exchange(m_record, nullptr))
+				{
+					rcu_domain::global().release_record(*owned);
+				}
+				get_owner_destroyed() = true;
+			}
+			record* m_record{ nullptr };
+		};
+
+		rcu_domain() noexcept = default;
+		~rcu_domain() = default;
+
+		/**	The hook installed into replaced_hooks.
+		 */
+		static void retain_replaced(control* const ctrl) noexcept
+		{
+			global().retain(ctrl);
+		}
+
+		/**	Return whether the calling thread's thread_owner has been destroyed.
+		 *	@return The flag, which is trivially destructible & so safe to use throughout thread exit.
+		 */
+		static bool& get_owner_destroyed() noexcept
+		{
+			thread_local bool destroyed{ false };
+			return destroyed;
+		}
+		/**	Return the calling thread's record, acquiring one upon first use.
+		 *	@return The record or nullptr if one couldn't be allocated or the thread_owner has been destroyed during
+		 *		thread exit, after which retirements wait for their grace periods.
+		 */
+		record* local_record() noexcept
+		{
+			if (get_owner_destroyed())
+			{
+				return nullptr;
+			}
+			thread_local thread_owner owner;
+			if (owner.m_record == nullptr)
+			{
+				owner.m_record = this->acquire_record();
+			}
+			return owner.m_record;
+		}
+		/**	Acquire a record for exclusive use by the calling thread.
+		 *	@return A record outside any read section with nothing retired, or nullptr if one couldn't be allocated.
+		 */
+		record* acquire_record() noexcept
+		{
+			for (record* candidate = m_records.load(std::memory_order_acquire); candidate; candidate = candidate->m_next)
+			{
+				bool active = false;
+				if (candidate->m_active.load(std::memory_order_relaxed) == false
+					&& candidate->m_active.compare_exchange_strong(active, true, std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					return candidate;
+				}
+			}
+			record* const created = new(std::nothrow) record{};
+			if (created == nullptr)
+			{
+				return nullptr;
+			}
+			record* head = m_records.load(std::memory_order_relaxed);
+			do
+			{
+				created->m_next = head;
+			} while (m_records.compare_exchange_weak(head, created, std::memory_order_seq_cst, std::memory_order_relaxed) == false);
+			return created;
+		}
+		/**	Release a record at thread exit or after a read section that acquired it, orphaning anything retired still
+		 *	within a grace period.
+		 *	@param released The record, owned by the calling thread.
+		 */
+		void release_record(record& released) noexcept
+		{
+			SH_POINTER_ASSERT(released.m_depth == 0, "Didn't expect a thread to exit within a read section.");
+			this->reclaim(released);
+			if (released.m_retired.empty() == false)
+			{
+				std::vector<retired> remaining = std::move(released.m_retired);
+				released.m_retired.clear();
+				bool orphaned = false;
+				{
+					const std::lock_guard<std::mutex> lock{ m_orphans_mutex };
+					try
+					{
+						m_orphans.insert(m_orphans.end(), remaining.begin(), remaining.end());
+						m_orphan_count.store(m_orphans.size(), std::memory_order_release);
+						orphaned = true;
+					}
+					catch (const std::bad_alloc&)
+					{
+					}
+				}
+				if (orphaned == false)
+				{
+					for (const retired& entry : remaining)
+					{
+						this->release_after(entry);
+					}
+				}
+			}
+			released.m_active.store(false, std::memory_order_release);
+		}
+
+		/**	Return true if any thread is within a read section.
+		 */
+		bool is_reading() const noexcept
+		{
+			for (const record* candidate = m_records.load(std::memory_order_seq_cst); candidate; candidate = candidate->m_next)
+			{
+				if (candidate->m_epoch.load(std::memory_order_seq_cst) != 0)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/**	Return the epoch upon entering the oldest read section in progress.
+		 *	@return The epoch or the maximum epoch_t if no thread is within a read section.
+		 */
+		epoch_t oldest_reader() const noexcept
+		{
+			epoch_t oldest = std::numeric_limits<epoch_t>::max();
+			for (const record* candidate = m_records.load(std::memory_order_seq_cst); candidate; candidate = candidate->m_next)
+			{
+				const epoch_t epoch = candidate->m_epoch.load(std::memory_order_seq_cst);
+				if (epoch != 0 && epoch < oldest)
+				{
+					oldest = epoch;
+				}
+			}
+			return oldest;
+		}
+		/**	Release references retired within a record whose grace periods have passed, adopting any orphans.
+		 *	@param local The calling thread's record.
+		 */
+		void reclaim(record& local) noexcept
+		{
+			// Release from a list of our own, as destruction of a value may
+			// replace others within atomics & so retire more:
+			std::vector<retired> pending = std::move(local.m_retired);
+			local.m_retired.clear();
+			if (m_orphan_count.load(std::memory_order_acquire) != 0)
+			{
+				const std::lock_guard<std::mutex> lock{ m_orphans_mutex };
+				try
+				{
+					pending.insert(pending.end(), m_orphans.begin(), m_orphans.end());
+					m_orphans.clear();
+					m_orphan_count.store(0, std::memory_order_release);
+				}
+				catch (const std::bad_alloc&)
+				{
+				}
+			}
+
+			const epoch_t oldest = this->oldest_reader();
+			std::size_t kept = 0;
+			for (const retired& entry : pending)
+			{
+				if (entry.m_epoch <= oldest)
+				{
+					entry.m_ctrl->shared_dec();
+				}
+				else
+				{
+					pending[kept++] = entry;
+				}
+			}
+			pending.resize(kept);
+
+			if (local.m_retired.empty())
+			{
+				local.m_retired = std::move(pending);
+				return;
+			}
+			try
+			{
+				local.m_retired.insert(local.m_retired.end(), pending.begin(), pending.end());
+			}
+			catch (const std::bad_alloc&)
+			{
+				for (const retired& entry : pending)
+				{
+					this->release_after(entry);
+				}
+			}
+		}
+		/**	Wait for the grace period of a retired reference to pass, then release it.
+		 *	@param entry The retired reference.
+		 */
+		void release_after(const retired& entry) noexcept
+		{
+			while (this->oldest_reader() < entry.m_epoch)
+			{
+				std::this_thread::yield();
+			}
+			entry.m_ctrl->shared_dec();
+		}
+
+		/**	The current epoch, advanced upon each retirement. Zero is reserved to mark records outside any read section.
+		 */
+		std::atomic<epoch_t> m_epoch{ 1 };
+		/**	Singly linked list of records, pushed to the front.
+		 */
+		std::atomic<record*> m_records{ nullptr };
+		/**	References retired by exited threads, adopted by the next thread to reclaim.
+		 */
+		std::vector<retired> m_orphans;
+		std::mutex m_orphans_mutex;
+		/**	The size of m_orphans, readable without m_orphans_mutex.
+		 */
+		std::atomic<std::size_t> m_orphan_count{ 0 };
+	};
+
+} // namespace sh::pointer
+
+namespace sh
+{
+	/**	An epoch-based read section, within which values of std::atomic<sh::shared_ptr> may be borrowed without
+	 *	modifying reference counts. Read sections may nest.
+	 *	@note Borrowed values remain valid until the outermost read section on the calling thread ends. Guards may not
+	 *		be passed between threads. Long read sections delay reclamation for all threads.
+	 */
+	class rcu_read_guard final
+	{
+	public:
+		/**	Enter a read section.
+		 *	@throw std::bad_alloc If the calling thread's first read section & its record couldn't be allocated.
+		 */
+		rcu_read_guard()
+			: m_record{ pointer::rcu_domain::global().local_record() }
+			, m_acquired{ m_record == nullptr }
+		{
+			if (m_acquired)
+			{
+				// Without a record of its own, such as during thread exit after releasing it, acquire one for this
+				// read section alone:
+				m_record = pointer::rcu_domain::global().acquire_record();
+				if (m_record == nullptr)
+				{
+					throw std::bad_alloc{};
+				}
+			}
+			if (m_record->m_depth++ == 0)
+			{
+				// Install before entering, such that writers that don't find the hook replaced what we load first:
+				pointer::replaced_hooks::install(&pointer::rcu_domain::retain_replaced);
+				m_record->m_epoch.store(pointer::rcu_domain::global().m_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+				// Order the epoch before loads within the read section, such
+				// that writers replacing what we load will find it:
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+			}
+		}
+		/**	Leave a read section.
+		 */
+		~rcu_read_guard()
+		{
+			if (--m_record->m_depth == 0)
+			{
+				// Release such that borrows happen before reclamation:
+				m_record->m_epoch.store(0, std::memory_order_release);
+			}
+			if (m_acquired)
+			{
+				pointer::rcu_domain::global().release_record(*m_record);
+			}
+		}
+		rcu_read_guard(const rcu_read_guard&) = delete;
+		rcu_read_guard& operator=(const rcu_read_guard&) = delete;
+
+		/**	Borrow the value held by an atomic shared_ptr until the outermost read section ends.
+		 *	@param source The atomic from which to borrow.
+		 *	@return The value that source held at some point during this call. May be nullptr.
+		 */
+		template <typename T>
+		[[nodiscard]] typename shared_ptr<T>::element_type* load(const std::atomic<shared_ptr<T>>& source) const noexcept
+		{
+			using element_type = typename shared_ptr<T>::element_type;
+			return pointer::convert_control_to_value<element_type*>(source.peek(std::memory_order_acquire));
+		}
+
+	private:
+		/**	The calling thread's record, or one acquired for this read section alone.
+		 */
+		pointer::rcu_domain::record* m_record;
+		/**	True if m_record was acquired for this read section alone & so is released with it.
+		 */
+		const bool m_acquired;
+	};
+} // namespace sh
+
+#endif
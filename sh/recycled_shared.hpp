@@ -0,0 +1,446 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__RECYCLED_SHARED_HPP
+#define INC_SH__RECYCLED_SHARED_HPP
+
+/**	@file
+ *	This file declares sh::make_recycled_shared & sh::recycled_shared_stats,
+ *	which return the storage (control block + value) of a sh::shared_ptr to a
+ *	per-type free list rather than freeing it:
+ *
+ *		sh::shared_ptr<T> x = sh::make_recycled_shared<T>(args...);
+ *		const sh::pointer::recycle_stats stats = sh::recycled_shared_stats<T>();
+ *
+ *	When the last reference to storage is released, it's pushed onto a free
+ *	list of up to SH_POINTER_RECYCLE_CAPACITY blocks for T. The next
+ *	make_recycled_shared<T> pops a block from it instead of allocating. Blocks
+ *	beyond capacity are freed. The free list is lock-free: blocks are
+ *	exchanged in & out of a bounded array of slots & so aren't subject to ABA.
+ *
+ *	If SH_POINTER_RECYCLE_PER_THREAD is non-zero, each thread additionally
+ *	keeps up to SH_POINTER_RECYCLE_THREAD_CAPACITY blocks for T that it pops
+ *	& pushes without synchronization, spilling to the shared free list when
+ *	full & upon thread exit.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "shared_ptr.hpp"
+
+/**	The number of blocks per type that may be held by the shared free list.
+ */
+#if !defined(SH_POINTER_RECYCLE_CAPACITY)
+	#define SH_POINTER_RECYCLE_CAPACITY 64
+#endif // SH_POINTER_RECYCLE_CAPACITY
+
+/**	If non-zero, each thread caches blocks per type ahead of the shared free list.
+ */
+#if !defined(SH_POINTER_RECYCLE_PER_THREAD)
+	#define SH_POINTER_RECYCLE_PER_THREAD 0
+#endif // SH_POINTER_RECYCLE_PER_THREAD
+
+/**	The number of blocks per type that may be cached by each thread if SH_POINTER_RECYCLE_PER_THREAD.
+ */
+#if !defined(SH_POINTER_RECYCLE_THREAD_CAPACITY)
+	#define SH_POINTER_RECYCLE_THREAD_CAPACITY 16
+#endif // SH_POINTER_RECYCLE_THREAD_CAPACITY
+
+namespace sh::pointer
+{
+	/**	A snapshot of the counters of a recycler.
+	 */
+	struct recycle_stats final
+	{
+		/**	The number of blocks held for reuse, whether by the shared free list or by threads.
+		 */
+		std::size_t m_depth;
+		/**	The number of allocations served by a recycled block.
+		 */
+		std::size_t m_hits;
+		/**	The number of allocations that found no block to recycle & so allocated.
+		 */
+		std::size_t m_misses;
+		/**	The number of blocks freed because the free lists were full.
+		 */
+		std::size_t m_discards;
+	};
+
+	/**	Bounded free lists of blocks allocated on behalf of Key, used by recycling_allocator.
+	 *	@tparam Key The type on behalf of which blocks are recycled, typically the value type of a sh::shared_ptr.
+	 *	@detail A single instance exists per Key. Blocks are kept per type of allocation, of which
+	 *		sh::make_recycled_shared uses one per Key.
+	 */
+	template <typename Key>
+	class recycler final
+	{
+	public:
+		/**	The number of blocks per type of allocation that may be held by the shared free list.
+		 */
+		static constexpr std::size_t capacity{ SH_POINTER_RECYCLE_CAPACITY };
+		/**	The number of blocks per type of allocation that may be cached by each thread.
+		 */
+		static constexpr std::size_t thread_capacity{ SH_POINTER_RECYCLE_PER_THREAD ? SH_POINTER_RECYCLE_THREAD_CAPACITY : 0 };
+
+		recycler(const recycler&) = delete;
+		recycler& operator=(const recycler&) = delete;
+
+		/**	Return the recycler for Key.
+		 *	@return A reference to the instance, which is never destroyed such that objects with static storage
+		 *		duration may safely release blocks during their own destruction.
+		 */
+		static recycler& global() noexcept
+		{
+			static recycler* const instance = new recycler{};
+			return *instance;
+		}
+
+		/**	Return a recycled block of type T, if any.
+		 *	@tparam T The type of allocation.
+		 *	@return A block previously given to push or nullptr.
+		 */
+		template <typename T>
+		T* pop() noexcept
+		{
+			void* block{ nullptr };
+			if constexpr (thread_capacity > 0)
+			{
+				if (local_list<T>* const list = local<T>())
+				{
+					block = list->pop();
+				}
+			}
+			if (block == nullptr)
+			{
+				block = shared<T>().pop();
+			}
+			if (block == nullptr)
+			{
+				m_misses.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+			m_hits.fetch_add(1, std::memory_order_relaxed);
+			m_depth.fetch_sub(1, std::memory_order_relaxed);
+			return static_cast<T*>(block);
+		}
+		/**	Hold a block of type T for reuse.
+		 *	@tparam T The type of allocation.
+		 *	@param block The block, allocated by std::allocator<T> for a single T.
+		 *	@return True if the block is held. Otherwise, the caller must free it.
+		 */
+		template <typename T>
+		bool push(T* const block) noexcept
+		{
+			bool held{ false };
+			if constexpr (thread_capacity > 0)
+			{
+				if (local_list<T>* const list = local<T>())
+				{
+					held = list->push(block);
+				}
+			}
+			if (false == held)
+			{
+				held = shared<T>().push(block);
+			}
+			if (false == held)
+			{
+				m_discards.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			m_depth.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/**	Return a snapshot of this recycler's counters.
+		 *	@return The counters, each read independently of the others.
+		 */
+		recycle_stats stats() const noexcept
+		{
+			// m_depth may be momentarily negative if a block is popped before its push is counted.
+			return recycle_stats{
+				std::size_t(std::max(std::ptrdiff_t{ 0 }, m_depth.load(std::memory_order_relaxed))),
+				m_hits.load(std::memory_order_relaxed),
+				m_misses.load(std::memory_order_relaxed),
+				m_discards.load(std::memory_order_relaxed)
+			};
+		}
+
+	private:
+		recycler() = default;
+
+		/**	A lock-free bounded free list shared by all threads.
+		 */
+		class shared_list final
+		{
+		public:
+			/**	Return a block, if any.
+			 *	@return A block or nullptr.
+			 */
+			void* pop() noexcept
+			{
+				const std::size_t count = m_count.load(std::memory_order_relaxed);
+				if (count == 0)
+				{
+					return nullptr;
+				}
+				// Slots are mostly filled from the front, so scan backward from the last likely to be filled.
+				for (std::size_t offset = 0; offset < capacity; ++offset)
+				{
+					std::atomic<void*>& slot = m_slots[(std::min(count, capacity) - 1 + capacity - offset) % capacity];
+					if (slot.load(std::memory_order_relaxed) != nullptr)
+					{
+						if (void* const block = slot.exchange(nullptr, std::memory_order_acquire))
+						{
+							// Release the reservation only after emptying the slot, so reserved slots never exceed capacity.
+							m_count.fetch_sub(1, std::memory_order_relaxed);
+							return block;
+						}
+					}
+				}
+				return nullptr;
+			}
+			/**	Hold a block if there's room.
+			 *	@param block The block.
+			 *	@return True if the block is held.
+			 */
+			bool push(void* const block) noexcept
+			{
+				// Reserve a slot first. As reservations never exceed capacity, an empty slot must exist.
+				if (m_count.load(std::memory_order_relaxed) >= capacity)
+				{
+					return false;
+				}
+				const std::size_t reserved = m_count.fetch_add(1, std::memory_order_relaxed);
+				if (reserved >= capacity)
+				{
+					m_count.fetch_sub(1, std::memory_order_relaxed);
+					return false;
+				}
+				// Scan forward from the slot following those likely to be filled.
+				for (std::size_t offset = 0; ; ++offset)
+				{
+					std::atomic<void*>& slot = m_slots[(reserved + offset) % capacity];
+					void* expected{ nullptr };
+					if (slot.load(std::memory_order_relaxed) == nullptr
+						&& slot.compare_exchange_strong(expected, block, std::memory_order_release, std::memory_order_relaxed))
+					{
+						return true;
+					}
+				}
+			}
+
+		private:
+			std::atomic<std::size_t> m_count{ 0 };
+			std::atomic<void*> m_slots[capacity]{};
+		};
+
+		/**	A free list cached by one thread, spilled to the shared free list upon thread exit.
+		 *	@tparam T The type of allocation.
+		 */
+		template <typename T>
+		class local_list final
+		{
+		public:
+			local_list() = default;
+			local_list(const local_list&) = delete;
+			local_list& operator=(const local_list&) = delete;
+			~local_list()
+			{
+				recycler& owner = recycler::global();
+				while (m_count > 0)
+				{
+					T* const block = static_cast<T*>(m_blocks[--m_count]);
+					if (false == recycler::shared<T>().push(block))
+					{
+						owner.m_depth.fetch_sub(1, std::memory_order_relaxed);
+						owner.m_discards.fetch_add(1, std::memory_order_relaxed);
+						std::allocator<T>{}.deallocate(block, 1);
+					}
+				}
+				local_destroyed<T>() = true;
+			}
+
+			void* pop() noexcept
+			{
+				return m_count > 0 ? m_blocks[--m_count] : nullptr;
+			}
+			bool push(void* const block) noexcept
+			{
+				if (m_count == thread_capacity)
+				{
+					return false;
+				}
+				m_blocks[m_count++] = block;
+				return true;
+			}
+
+		private:
+			std::size_t m_count{ 0 };
+			void* m_blocks[thread_capacity > 0 ? thread_capacity : 1];
+		};
+
+		/**	Return the shared free list for allocations of type T.
+		 *	@tparam T The type of allocation.
+		 *	@return A reference to the free list, which is never destroyed.
+		 */
+		template <typename T>
+		static shared_list& shared() noexcept
+		{
+			static shared_list* const instance = new shared_list{};
+			return *instance;
+		}
+		/**	Return the calling thread's free list for allocations of type T.
+		 *	@tparam T The type of allocation.
+		 *	@return The free list, or nullptr if destroyed during thread exit, after which blocks go straight to the
+		 *		shared free list.
+		 */
+		template <typename T>
+		static local_list<T>* local() noexcept
+		{
+			if (local_destroyed<T>())
+			{
+				return nullptr;
+			}
+			thread_local local_list<T> instance;
+			return &instance;
+		}
+		/**	Return whether the calling thread's free list for allocations of type T has been destroyed.
+		 *	@tparam T The type of allocation.
+		 *	@return The flag, which is trivially destructible & so safe to use throughout thread exit.
+		 */
+		template <typename T>
+		static bool& local_destroyed() noexcept
+		{
+			thread_local bool destroyed{ false };
+			return destroyed;
+		}
+
+		std::atomic<std::ptrdiff_t> m_depth{ 0 };
+		std::atomic<std::size_t> m_hits{ 0 };
+		std::atomic<std::size_t> m_misses{ 0 };
+		std::atomic<std::size_t> m_discards{ 0 };
+	};
+
+	/**	An allocator that recycles single element allocations via recycler<Key> & otherwise uses std::allocator.
+	 *	@tparam T The value type.
+	 *	@tparam Key The type on behalf of which blocks are recycled, preserved by rebind.
+	 */
+	template <typename T, typename Key = T>
+	struct recycling_allocator
+	{
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		template <typename U>
+		struct rebind
+		{
+			using other = recycling_allocator<U, Key>;
+		};
+
+		recycling_allocator() = default;
+		recycling_allocator(const recycling_allocator& other) = default;
+		recycling_allocator& operator=(const recycling_allocator& other) = default;
+
+		template <typename U>
+		constexpr explicit recycling_allocator(const recycling_allocator<U, Key>&) noexcept
+		{ }
+
+		[[nodiscard]] T* allocate(const std::size_t n)
+		{
+			if (n == 1)
+			{
+				if (T* const block = recycler<Key>::global().template pop<T>())
+				{
+					return block;
+				}
+			}
+			return std::allocator<T>{}.allocate(n);
+		}
+		void deallocate(T* const p, const std::size_t n) noexcept
+		{
+			if (n == 1 && recycler<Key>::global().push(p))
+			{
+				return;
+			}
+			std::allocator<T>{}.deallocate(p, n);
+		}
+
+		template <typename U>
+		constexpr bool operator==(const recycling_allocator<U, Key>&) const noexcept
+		{
+			return true;
+		}
+	};
+} // namespace sh::pointer
+
+namespace sh
+{
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T, reusing storage previously released by
+	 *	another made by make_recycled_shared<T> if available.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>)
+	shared_ptr<T> make_recycled_shared(Args&&... args)
+	{
+		using element_type = std::remove_const_t<T>;
+		return sh::allocate_shared<T>(
+			pointer::recycling_allocator<element_type>{},
+			std::forward<Args>(args)...
+		);
+	}
+	/**	Return a snapshot of the counters of storage recycled by make_recycled_shared<T>.
+	 *	@tparam T The type of element given to make_recycled_shared.
+	 *	@return The counters.
+	 */
+	template <typename T>
+		requires (false == std::is_array_v<T>)
+	pointer::recycle_stats recycled_shared_stats() noexcept
+	{
+		return pointer::recycler<std::remove_const_t<T>>::global().stats();
+	}
+} // namespace sh
+
+#endif
@@ -0,0 +1,316 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__SHARDED_SHARED_HPP
+#define INC_SH__SHARDED_SHARED_HPP
+
+/**	@file
+ *	This file declares sh::allocate_sharded_shared and sh::make_sharded_shared,
+ *	which spread the shared reference count of an extremely hot value across
+ *	cache line separated shards:
+ *
+ *		sh::shared_ptr<T> x = sh::make_sharded_shared<T>(args...);
+ *		sh::shared_ptr<T> y = x; // Counted by the calling thread's shard.
+ *
+ *	Each thread copies & releases references in the shard to which it's
+ *	assigned, so that threads on different cores don't contend on one cache
+ *	line. A release first takes from the calling thread's shard, then from any
+ *	other, & only then from the control block's own count. The control block
+ *	always keeps at least one reference while sharded, so no shard can hold the
+ *	last; when a release would take its last, the shards are instead collapsed
+ *	into it and counting thereafter proceeds as for sh::make_shared, detecting
+ *	the release of the last reference exactly.
+ *
+ *	Each value carries SH_POINTER_SHARD_COUNT * SH_POINTER_CACHE_LINE_SIZE
+ *	bytes of shards, so sharding suits a few long lived values copied by many
+ *	threads, such as a routing table or configuration snapshot.
+ *
+ *	Sharding requires SH_POINTER_SPECIAL_COUNT to be defined as non-zero.
+ *	Otherwise, sh::make_sharded_shared is equivalent to sh::make_shared.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "shared_ptr.hpp"
+
+#if SH_POINTER_SPECIAL_COUNT
+namespace sh::pointer
+{
+	/**	Allocate a sharded control block associated with a value of type T using a given allocator.
+	 *	@tparam T The value type.
+	 *	@tparam Alloc The allocator type.
+	 */
+	template <
+		typename T,
+		typename Alloc
+	>
+		requires (false == std::is_array_v<T>)
+	class sharded_value_convertible_to_control final
+	{
+	private:
+		using element_type = T;
+		static_assert(alignof(element_type) <= max_alignment,
+			"element_type has extended alignment, beyond that which sh::shared_ptr expects. See sh::pointer::max_alignment.");
+
+		using allocator_traits = std::allocator_traits<Alloc>;
+		using value_allocator_traits = typename allocator_traits::template rebind_traits<element_type>;
+		using value_allocator = typename value_allocator_traits::allocator_type;
+
+		/**	Shards followed by a convertible control block, storage space for an associated value & an allocator.
+		 */
+		struct storage_type final
+		{
+			/**	Construct storage for an element_type.
+			 *	@param alloc The allocator to be used for constructing and destroying the value.
+			 */
+			explicit storage_type(value_allocator&& alloc) noexcept
+				: m_ctrl{ control::shared_one | control::sharded_bit, sharded_value_convertible_to_control::operations() }
+				, m_alloc{ std::move(alloc) }
+			{
+				static_assert(std::is_nothrow_move_constructible_v<value_allocator>,
+					"Exceptions from value_allocator move contructor aren't expected.");
+				static_assert(offsetof(storage_type, m_ctrl) == sizeof(control_shards),
+					"control::get_shards only valid if control_shards immediately precedes m_ctrl.");
+				static_assert(offsetof(storage_type, m_value) - offsetof(storage_type, m_ctrl) == sizeof(convertible_control),
+					"convert_value_to_control only valid if m_ctrl to m_value offset is sizeof(convertible_control).");
+			}
+
+			/**	Shard counts, which must immediately precede m_ctrl.
+			 */
+			control_shards m_shards;
+
+			/**	Control block convertible to and from m_value.
+			 */
+			convertible_control m_ctrl;
+
+			/**	Storage space to be used for the construction of element_type.
+			 *	@note Must immediately follow and be similarly aligned to convertible_control for conversion to work.
+			 */
+			alignas(convertible_control) std::byte m_value[sizeof(element_type)];
+
+			/**	Allocator used for constructing and destroying value.
+			 */
+			SH_POINTER_NO_UNIQUE_ADDRESS value_allocator m_alloc;
+		};
+
+		using storage_allocator_traits = typename allocator_traits::template rebind_traits<storage_type>;
+		using storage_allocator = typename storage_allocator_traits::allocator_type;
+
+		/**	Return the storage_type containing a control block.
+		 *	@param ctrl The control block.
+		 *	@return The storage_type offsetof(storage_type, m_ctrl) bytes before \p ctrl.
+		 */
+		static storage_type* to_storage(control* const ctrl) noexcept
+		{
+			return backward_offset_cast<storage_type*>(
+				static_cast<convertible_control*>(ctrl),
+				std::integral_constant<std::size_t, offsetof(storage_type, m_ctrl)>{});
+		}
+
+#if SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+		/**	For debug validation & profiling, return a pointer to a static string identifying this class.
+		 *	@return A pointer to a static string identifying this class.
+		 */
+		static const char* origin() noexcept
+		{
+			static const char* const instance = typeid(sharded_value_convertible_to_control).name();
+			return instance;
+		}
+#endif // SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+
+		/**	Return a reference to a static control_operations structure.
+		 *	@return A reference to a static control_operations structure.
+		 */
+		static const control_operations& operations() noexcept
+		{
+			static constexpr auto destruct = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_destruct(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+				storage_type* const storage = to_storage(ctrl);
+				element_type& value = convert_control_to_value<element_type&>(storage->m_ctrl);
+				value_allocator_traits::destroy(storage->m_alloc, std::addressof(value));
+			};
+			static constexpr auto deallocate = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_deallocate(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+				storage_type* const storage = to_storage(ctrl);
+
+				// Move this allocator out of storage before destroying & deleting it.
+				storage_allocator storage_alloc{ std::move(storage->m_alloc) };
+				storage_allocator_traits::destroy(storage_alloc, storage);
+				storage_allocator_traits::deallocate(storage_alloc, storage, 1);
+			};
+			static const control_operations instance{
+#ifdef __cpp_designated_initializers
+				.m_destruct =
+#endif // __cpp_designated_initializers
+				/* destruct */ destruct,
+#ifdef __cpp_designated_initializers
+				.m_deallocate =
+#endif // __cpp_designated_initializers
+				/* deallocate */ deallocate,
+#ifdef __cpp_designated_initializers
+				.m_destruct_deallocate =
+#endif // __cpp_designated_initializers
+				/* destruct_deallocate */
+				[](control* const ctrl) noexcept -> void
+				{
+					destruct(ctrl);
+					deallocate(ctrl);
+				},
+#ifdef __cpp_designated_initializers
+				.m_get_deleter =
+#endif // __cpp_designated_initializers
+				/* get_deleter */ nullptr,
+#if SH_POINTER_PROFILE
+#ifdef __cpp_designated_initializers
+				.m_get_origin =
+#endif // __cpp_designated_initializers
+				/* get_origin */ origin,
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_BIASED_COUNT
+#ifdef __cpp_designated_initializers
+				.m_bias_offset =
+#endif // __cpp_designated_initializers
+				/* bias_offset */ 0,
+#endif // SH_POINTER_BIASED_COUNT
+			};
+			return instance;
+		}
+
+	public:
+		/**	Allocate a sharded control block associated with a value using a given allocator, the latter constructed
+		 *	with the given arguments.
+		 *	@throw May throw std::bad_alloc or other exceptions during allocation & construction.
+		 *	@tparam Args The argument types to pass to value's constructor T::T.
+		 *	@param alloc The allocator.
+		 *	@param args The arguments to pass to value's constructor T::T.
+		 *	@return The pointer to the control value. Use convert_value_to_control to access the associated control block.
+		 */
+		template <typename... Args>
+		static element_type* allocate(const Alloc& alloc, Args&&... args)
+		{
+			storage_allocator storage_alloc{ alloc };
+			storage_type* const storage = storage_allocator_traits::allocate(storage_alloc, 1);
+			storage_allocator_traits::construct(storage_alloc, storage, value_allocator{ alloc });
+
+			element_type* const value = reinterpret_cast<element_type*>(&storage->m_value);
+			try
+			{
+				value_allocator_traits::construct(storage->m_alloc, value, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				storage_allocator_traits::destroy(storage_alloc, storage);
+				storage_allocator_traits::deallocate(storage_alloc, storage, 1);
+				throw;
+			}
+			static_assert(false == std::is_convertible_v<element_type*, control_from_this*>,
+				"enable_shared_from_this isn't supported by sharded values.");
+			static_assert(false == is_weak_free_v<element_type>,
+				"Weak-free types can't be sharded.");
+#if SH_POINTER_DEBUG_SHARED_PTR
+			storage->m_ctrl.validate_set_origin(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+			return value;
+		}
+	};
+} // namespace sh::pointer
+#endif // SH_POINTER_SPECIAL_COUNT
+
+namespace sh
+{
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T using the supplied allocator, counting
+	 *	shared references in per-thread shards until the last may be released.
+	 *	@note Without SH_POINTER_SPECIAL_COUNT, equivalent to allocate_shared.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Alloc The allocator type to use for construction and destruction.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param alloc The allocator to use.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename Alloc,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>
+			&& alignof(T) <= pointer::max_alignment)
+	shared_ptr<T> allocate_sharded_shared(const Alloc& alloc, Args&&... args)
+	{
+#if SH_POINTER_SPECIAL_COUNT
+		using element_type = std::remove_const_t<T>;
+		using origin_type = pointer::sharded_value_convertible_to_control<element_type, Alloc>;
+		return shared_ptr<T>{
+			origin_type::allocate(
+				alloc,
+				std::forward<Args>(args)...
+			)
+		};
+#else // !SH_POINTER_SPECIAL_COUNT
+		return sh::allocate_shared<T>(alloc, std::forward<Args>(args)...);
+#endif // !SH_POINTER_SPECIAL_COUNT
+	}
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T, counting shared references in per-thread
+	 *	shards until the last may be released. See allocate_sharded_shared.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>
+			&& alignof(T) <= pointer::max_alignment)
+	shared_ptr<T> make_sharded_shared(Args&&... args)
+	{
+		return sh::allocate_sharded_shared<T>(
+			pointer::default_allocator<std::remove_const_t<T>>{},
+			std::forward<Args>(args)...
+		);
+	}
+} // namespace sh
+
+#endif
@@ -0,0 +1,346 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef INC_SH__SHARED_ARENA_HPP
+#define INC_SH__SHARED_ARENA_HPP
+
+/**	@file
+ *	This file declares sh::shared_arena, sh::pointer::arena_allocator, and
+ *	sh::make_arena_shared, which allocate sh::shared_ptr storage from a
+ *	monotonic arena released all at once:
+ *
+ *		const sh::shared_arena arena;
+ *		sh::shared_ptr<T> x = sh::make_arena_shared<T>(arena, args...);
+ *		sh::shared_ptr<U[]> y = sh::allocate_shared<U[]>(arena.get_allocator<U>(), count);
+ *
+ *	Allocation bumps a pointer within chunks of at least
+ *	SH_POINTER_ARENA_CHUNK_SIZE bytes. Deallocation is only a decrement of the
+ *	arena's reference count, which each sh::shared_arena & each live
+ *	allocation holds. Memory is returned to the system when the last of
+ *	these is released, whichever thread that may be.
+ *
+ *	Allocation from an arena isn't synchronized & must be performed by one
+ *	thread at a time. Values may be released from any thread.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "shared_ptr.hpp"
+
+/**	The minimum size, in bytes, of each chunk allocated by sh::shared_arena.
+ */
+#if !defined(SH_POINTER_ARENA_CHUNK_SIZE)
+	#define SH_POINTER_ARENA_CHUNK_SIZE 16384
+#endif // SH_POINTER_ARENA_CHUNK_SIZE
+
+namespace sh
+{
+	class shared_arena;
+} // namespace sh
+
+namespace sh::pointer
+{
+	/**	The reference counted chunks of memory behind a shared_arena.
+	 */
+	class arena_resource final
+	{
+	public:
+		arena_resource(const arena_resource&) = delete;
+		arena_resource& operator=(const arena_resource&) = delete;
+
+		/**	Allocate memory from the arena, adding a reference released by deallocate.
+		 *	@throw std::bad_alloc If a chunk couldn't be allocated.
+		 *	@param size The number of bytes requested.
+		 *	@param alignment The alignment requested.
+		 *	@return Memory of \p size bytes aligned to \p alignment.
+		 */
+		[[nodiscard]] void* allocate(const std::size_t size, const std::size_t alignment)
+		{
+			void* memory = m_bump;
+			std::size_t space = std::size_t(m_end - m_bump);
+			if (std::align(alignment, size, memory, space) == nullptr)
+			{
+				memory = this->allocate_chunk(size, alignment);
+			}
+			m_bump = static_cast<std::byte*>(memory) + size;
+			m_refs.fetch_add(1, std::memory_order_relaxed);
+			return memory;
+		}
+		/**	Release the reference added by allocate. Memory isn't reused until every reference is released.
+		 */
+		void deallocate() noexcept
+		{
+			this->release();
+		}
+
+		/**	Return the number of bytes reserved from the system in chunks.
+		 */
+		std::size_t bytes_reserved() const noexcept
+		{
+			return m_bytes_reserved;
+		}
+		/**	Return the number of references held by shared_arena instances & live allocations.
+		 *	@note Stored count may change immediately after returning
+		 */
+		std::size_t use_count() const noexcept
+		{
+			return m_refs.load(std::memory_order_relaxed);
+		}
+
+	private:
+		friend class ::sh::shared_arena;
+
+		/**	The header at the start of each chunk.
+		 */
+		struct alignas(max_alignment) chunk_header final
+		{
+			chunk_header* const m_next;
+			const std::size_t m_size;
+		};
+
+		/**	Construct an arena holding a single reference.
+		 *	@param chunk_size The minimum size of each chunk.
+		 */
+		explicit arena_resource(const std::size_t chunk_size) noexcept
+			: m_chunk_size{ chunk_size }
+		{ }
+		~arena_resource()
+		{
+			for (chunk_header* chunk = m_chunks; chunk; )
+			{
+				chunk_header* const next = chunk->m_next;
+				const std::size_t size = chunk->m_size;
+				chunk->~chunk_header();
+				::operator delete(static_cast<void*>(chunk), size);
+				chunk = next;
+			}
+		}
+
+		void add_ref() noexcept
+		{
+			m_refs.fetch_add(1, std::memory_order_relaxed);
+		}
+		void release() noexcept
+		{
+			if (m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				delete this;
+			}
+		}
+
+		/**	Allocate a chunk with room for a request & make it current.
+		 *	@throw std::bad_alloc If the chunk couldn't be allocated.
+		 *	@param size The number of bytes requested.
+		 *	@param alignment The alignment requested.
+		 *	@return Memory of \p size bytes aligned to \p alignment within the new chunk.
+		 */
+		void* allocate_chunk(const std::size_t size, const std::size_t alignment)
+		{
+			const std::size_t required = sizeof(chunk_header) + size + (alignment > max_alignment ? alignment : 0);
+			const std::size_t chunk_size = required > m_chunk_size ? required : m_chunk_size;
+			std::byte* const memory = static_cast<std::byte*>(::operator new(chunk_size));
+			m_chunks = ::new(memory) chunk_header{ m_chunks, chunk_size };
+			m_bytes_reserved += chunk_size;
+
+			void* aligned = memory + sizeof(chunk_header);
+			std::size_t space = chunk_size - sizeof(chunk_header);
+			aligned = std::align(alignment, size, aligned, space);
+			SH_POINTER_ASSERT(aligned != nullptr, "Arena chunk is too small for its request.");
+			m_end = memory + chunk_size;
+			return aligned;
+		}
+
+		/**	The most recent chunk, linked to those before it.
+		 */
+		chunk_header* m_chunks{ nullptr };
+		/**	The unallocated remainder of the most recent chunk.
+		 */
+		std::byte* m_bump{ nullptr };
+		std::byte* m_end{ nullptr };
+		/**	The minimum size of each chunk.
+		 */
+		const std::size_t m_chunk_size;
+		/**	The total size of all chunks.
+		 */
+		std::size_t m_bytes_reserved{ 0 };
+		/**	References held by shared_arena instances & live allocations.
+		 */
+		std::atomic<std::size_t> m_refs{ 1 };
+	};
+
+	/**	An allocator drawing from a shared_arena, suitable for use with sh::allocate_shared.
+	 *	@note Doesn't hold a reference to the arena itself, so must not allocate after the last shared_arena is
+	 *		destroyed. Copies held by allocations (e.g., within a control block) may deallocate at any time.
+	 *	@tparam T The value type.
+	 */
+	template <typename T>
+	struct arena_allocator
+	{
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		template <typename U>
+		struct rebind
+		{
+			using other = arena_allocator<U>;
+		};
+
+		template <typename U>
+		friend struct arena_allocator;
+
+		/**	Construct an allocator drawing from an arena.
+		 *	@param resource The arena.
+		 */
+		explicit arena_allocator(arena_resource& resource) noexcept
+			: m_resource{ &resource }
+		{ }
+		arena_allocator(const arena_allocator& other) = default;
+		arena_allocator& operator=(const arena_allocator& other) = default;
+
+		template <typename U>
+		constexpr explicit arena_allocator(const arena_allocator<U>& other) noexcept
+			: m_resource{ other.m_resource }
+		{ }
+
+		[[nodiscard]] T* allocate(const std::size_t n)
+		{
+			if (n > std::size_t(-1) / sizeof(T))
+			{
+				throw std::bad_array_new_length{};
+			}
+			return static_cast<T*>(m_resource->allocate(n * sizeof(T), alignof(T)));
+		}
+		void deallocate(T* const, const std::size_t) noexcept
+		{
+			m_resource->deallocate();
+		}
+
+		template <typename U>
+		bool operator==(const arena_allocator<U>& other) const noexcept
+		{
+			return m_resource == other.m_resource;
+		}
+
+	private:
+		arena_resource* m_resource;
+	};
+} // namespace sh::pointer
+
+namespace sh
+{
+	/**	A reference counted handle to a monotonic arena from which sh::shared_ptr storage may be allocated. The arena
+	 *	is released once every handle & every value allocated from it is.
+	 */
+	class shared_arena final
+	{
+	public:
+		/**	Construct a new arena.
+		 *	@throw std::bad_alloc If the arena couldn't be allocated.
+		 *	@param chunk_size The minimum size of each chunk the arena reserves from the system.
+		 */
+		explicit shared_arena(const std::size_t chunk_size = SH_POINTER_ARENA_CHUNK_SIZE)
+			: m_resource{ new pointer::arena_resource{ chunk_size } }
+		{ }
+		shared_arena(const shared_arena& other) noexcept
+			: m_resource{ other.m_resource }
+		{
+			m_resource->add_ref();
+		}
+		shared_arena& operator=(const shared_arena& other) noexcept
+		{
+			other.m_resource->add_ref();
+			m_resource->release();
+			m_resource = other.m_resource;
+			return *this;
+		}
+		~shared_arena()
+		{
+			m_resource->release();
+		}
+
+		/**	Return an allocator drawing from this arena.
+		 *	@tparam T The allocator's value type.
+		 */
+		template <typename T = std::byte>
+		pointer::arena_allocator<T> get_allocator() const noexcept
+		{
+			return pointer::arena_allocator<T>{ *m_resource };
+		}
+		/**	Return the number of bytes reserved from the system in chunks.
+		 */
+		std::size_t bytes_reserved() const noexcept
+		{
+			return m_resource->bytes_reserved();
+		}
+		/**	Return the number of references held by shared_arena instances & live allocations.
+		 *	@note Stored count may change immediately after returning
+		 */
+		std::size_t use_count() const noexcept
+		{
+			return m_resource->use_count();
+		}
+
+	private:
+		/**	The arena. Never nullptr.
+		 */
+		pointer::arena_resource* m_resource;
+	};
+
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T allocated from an arena.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param arena The arena from which to allocate.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>)
+	shared_ptr<T> make_arena_shared(const shared_arena& arena, Args&&... args)
+	{
+		return sh::allocate_shared<T>(
+			arena.get_allocator<std::remove_const_t<T>>(),
+			std::forward<Args>(args)...
+		);
+	}
+} // namespace sh
+
+#endif
@@ -36,16 +36,21 @@
  *	This file declares sh::shared_ptr, sh::weak_ptr, and related functions
  *	mirroring those in <memory>:
  *		* allocate_shared
+ *		* allocate_shared_biased
  *		* allocate_shared_for_overwrite
+ *		* allocate_immortal_shared
  *		* const_pointer_cast
  *		* dynamic_pointer_cast
  *		* get_deleter
  *		* make_shared
+ *		* make_shared_biased
  *		* make_shared_for_overwrite
+ *		* make_immortal_shared
  *		* owner_less
  *		* reinterpret_pointer_cast
  *		* static_pointer_cast
  *		* std::hash<sh::shared_ptr>
+ *	Along with sh::weak_free, a base class for types never weakly referenced.
  *
  *	Where most implementation of std::shared_ptr and std::weak_ptr are two
  *	pointers in size, sh::shared_ptr and sh::weak_ptr are only one. To achieve
@@ -60,18 +65,27 @@
  *			b. Conversion to a sh::wide_shared_ptr is required in these cases.
  *		3. Aliased construction is unavailable.
  *			a. See 2a & 2b.
- *		4. Types with extended alignment may not be supported (see
+ *		4. Arrays of types with extended alignment aren't supported (see
  *		   sh::pointer::max_alignment).
- *			a. You can increase the supported alignment by altering
+ *			a. Single values with extended alignment are supported by padding
+ *			   only their own allocations.
+ *			b. You can increase the supported alignment of arrays by altering
  *			   sh::pointer::max_alignment at the expense of increased memory used
  *			   for padding.
+ *			c. SH_POINTER_COMPACT_CONTROL lowers sh::pointer::max_alignment to
+ *			   8 bytes along with the size of each control block.
  */
 
+#include <algorithm>
 #include <atomic>
+#include <climits>
 #include <compare>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <limits>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <iosfwd>
@@ -80,14 +94,136 @@
 #include "pointer.hpp"
 
 /**	If SH_POINTER_DEBUG_SHARED_PTR is defined as non-zero, extra paranoid validation will be performed at runtime.
+ *	Validation state is kept in a side table (see sh::pointer::control_validation) rather than in control blocks, so
+ *	they're laid out as in release builds. It may be enabled in release builds too, along with an SH_POINTER_ASSERT
+ *	that reports failures despite NDEBUG, to validate a sample of control blocks.
  */
 #if !defined(SH_POINTER_DEBUG_SHARED_PTR) && !defined(NDEBUG)
 	#define SH_POINTER_DEBUG_SHARED_PTR 1
 #endif // !SH_POINTER_DEBUG_SHARED_PTR && !NDEBUG
 
-#if SH_POINTER_DEBUG_SHARED_PTR
+/**	SH_POINTER_VALIDATE_SAMPLE_RATE is the initial number of control blocks allocated per one validated if
+ *	SH_POINTER_DEBUG_SHARED_PTR, or zero to validate none until sh::pointer::control_validation::set_sample_rate is
+ *	called. Validates every control block unless NDEBUG is defined.
+ */
+#if !defined(SH_POINTER_VALIDATE_SAMPLE_RATE)
+	#if defined(NDEBUG)
+		#define SH_POINTER_VALIDATE_SAMPLE_RATE 0
+	#else // !NDEBUG
+		#define SH_POINTER_VALIDATE_SAMPLE_RATE 1
+	#endif // !NDEBUG
+#endif // SH_POINTER_VALIDATE_SAMPLE_RATE
+
+/**	If SH_POINTER_PROFILE is defined as non-zero, a sample of the reference count operations on control blocks is
+ *	recorded along with their type & calling thread, to find values whose counts bounce between threads' caches. See
+ *	sh::pointer::profile_report.
+ */
+#if !defined(SH_POINTER_PROFILE)
+	#define SH_POINTER_PROFILE 0
+#endif // SH_POINTER_PROFILE
+
+/**	SH_POINTER_PROFILE_SAMPLE_RATE is the initial number of reference count operations by each thread per one recorded
+ *	if SH_POINTER_PROFILE, or zero to record none until sh::pointer::control_profile::set_sample_rate is called.
+ */
+#if !defined(SH_POINTER_PROFILE_SAMPLE_RATE)
+	#define SH_POINTER_PROFILE_SAMPLE_RATE 64
+#endif // SH_POINTER_PROFILE_SAMPLE_RATE
+
+#if SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+	#include <mutex>
+	#include <thread>
 	#include <typeinfo>
-#endif // SH_POINTER_DEBUG_SHARED_PTR
+	#include <unordered_map>
+#endif // SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+
+#if SH_POINTER_PROFILE
+	#include <iomanip>
+	#include <iostream>
+	#include <vector>
+#endif // SH_POINTER_PROFILE
+
+/**	If SH_POINTER_BIASED_COUNT is defined as non-zero, control blocks created by sh::make_shared_biased and
+ *	sh::allocate_shared_biased count shared references taken & released by their creating thread without atomic
+ *	read-modify-write operations. Every control block then checks its operations for a bias upon counting shared
+ *	references, so this is off by default. If zero, sh::make_shared_biased is equivalent to sh::make_shared.
+ */
+#if !defined(SH_POINTER_BIASED_COUNT)
+	#define SH_POINTER_BIASED_COUNT 0
+#endif // SH_POINTER_BIASED_COUNT
+
+/**	If SH_POINTER_SPECIAL_COUNT is defined as non-zero, control blocks created by sh::make_immortal_shared skip
+ *	reference counting & those created by sh::make_sharded_shared count shared references in per-thread shards. Every
+ *	control block then checks for either upon counting references, so this is off by default. If zero,
+ *	sh::make_immortal_shared keeps one reference that's never released & sh::make_sharded_shared is equivalent to
+ *	sh::make_shared.
+ */
+#if !defined(SH_POINTER_SPECIAL_COUNT)
+	#define SH_POINTER_SPECIAL_COUNT 0
+#endif // SH_POINTER_SPECIAL_COUNT
+
+/**	If SH_POINTER_ITERATIVE_DESTRUCT is defined as non-zero, control blocks whose last references are released while
+ *	another is being released on the same thread (e.g., by the destructor of a node in a long sh::shared_ptr linked
+ *	list) are queued & released in a loop by the outermost release rather than recursively. This bounds stack use,
+ *	except for chains of values that are also weakly referenced, at the cost of a thread_local access per release.
+ */
+#if !defined(SH_POINTER_ITERATIVE_DESTRUCT)
+	#define SH_POINTER_ITERATIVE_DESTRUCT 0
+#endif // SH_POINTER_ITERATIVE_DESTRUCT
+
+/**	If SH_POINTER_COMPACT_CONTROL is defined as non-zero, each control block is a single 64-bit word in release builds,
+ *	packing value & control reference counts of 24 bits each with an index into a global table of control operations
+ *	rather than pointing to them. This saves 8 bytes per sh::shared_ptr allocation (more for small values, which
+ *	otherwise follow a control block padded to 16 bytes), but limits each value to 16,777,215 simultaneous references
+ *	& sh::pointer::max_alignment to 8 bytes.
+ */
+#if !defined(SH_POINTER_COMPACT_CONTROL)
+	#define SH_POINTER_COMPACT_CONTROL 0
+#endif // SH_POINTER_COMPACT_CONTROL
+
+/**	If SH_POINTER_SHARE_OPERATIONS is defined as non-zero, control blocks of trivially destructible values of the same
+ *	size & alignment, allocated by the same (rebind agnostic) allocator template, share one static table of control
+ *	operations rather than each value type instantiating its own. This trims code size & instruction cache pressure in
+ *	programs sharing many distinct small types, but reports the shared stand-in type as the origin in debug builds.
+ *	Defaults to zero if SH_POINTER_PROFILE, so profiles attribute each value to its own type.
+ */
+#if !defined(SH_POINTER_SHARE_OPERATIONS)
+	#if SH_POINTER_PROFILE
+		#define SH_POINTER_SHARE_OPERATIONS 0
+	#else // !SH_POINTER_PROFILE
+		#define SH_POINTER_SHARE_OPERATIONS 1
+	#endif // !SH_POINTER_PROFILE
+#endif // SH_POINTER_SHARE_OPERATIONS
+
+/**	SH_POINTER_SHARD_COUNT is the number of shards across which sh::make_sharded_shared spreads shared reference
+ *	counts. Threads are assigned to shards round-robin upon first use.
+ */
+#if !defined(SH_POINTER_SHARD_COUNT)
+	#define SH_POINTER_SHARD_COUNT 16
+#endif // SH_POINTER_SHARD_COUNT
+
+/**	SH_POINTER_CACHE_LINE_SIZE is the stride in bytes separating shard counts, so that no two share a cache line.
+ */
+#if !defined(SH_POINTER_CACHE_LINE_SIZE)
+	#define SH_POINTER_CACHE_LINE_SIZE 64
+#endif // SH_POINTER_CACHE_LINE_SIZE
+
+/**	If SH_POINTER_EXTERN_TEMPLATES is defined as non-zero, common instantiations (e.g., sh::shared_ptr<char[]> & the
+ *	control blocks of sh::make_shared<std::byte[]>) are declared extern & must be linked from the sh-pointer library,
+ *	built from sh/instantiations.cpp with the same SH_POINTER_ definitions & NDEBUG. This saves each translation unit
+ *	from instantiating them itself. Linking the sh-pointer CMake target defines it.
+ */
+#if !defined(SH_POINTER_EXTERN_TEMPLATES)
+	#define SH_POINTER_EXTERN_TEMPLATES 0
+#endif // SH_POINTER_EXTERN_TEMPLATES
+
+/**	SH_POINTER_EXTERN_TEMPLATE prefixes the declarations of common instantiations: extern if SH_POINTER_EXTERN_TEMPLATES,
+ *	or as explicit instantiation definitions within sh/instantiations.cpp, which defines SH_POINTER_INSTANTIATE.
+ */
+#if defined(SH_POINTER_INSTANTIATE)
+	#define SH_POINTER_EXTERN_TEMPLATE template
+#elif SH_POINTER_EXTERN_TEMPLATES
+	#define SH_POINTER_EXTERN_TEMPLATE extern template
+#endif // SH_POINTER_EXTERN_TEMPLATES
 
 /**	Define SH_POINTER_NO_UNIQUE_ADDRESS to alias C++20's [[no_unique_address]] or a compiler specific variant.
  */
@@ -109,13 +245,28 @@ namespace sh
 	template <typename T> class shared_ptr;
 	template <typename T> class weak_ptr;
 	template <typename T> class enable_shared_from_this;
+	class deferred_reclaimer;
+
+	/**	Public base class marking a type as weak-free: no sh::weak_ptr, sh::wide_weak_ptr, nor sh::local_weak_ptr may
+	 *	reference it, which fails to compile. sh::shared_ptr of a weak-free type then counts references without
+	 *	checking for weak references, immortal, sharded, nor biased control blocks, making each release a single
+	 *	atomic decrement & branch.
+	 *	@note Weak references mustn't be taken through a sh::shared_ptr to a base class that isn't weak-free either.
+	 *	@note Weak-free types can't be allocated by make_immortal_shared, make_sharded_shared, nor make_shared_biased.
+	 */
+	struct weak_free
+	{ };
 } // namespace sh
 
 namespace sh::pointer
 {
 	/**	The maximum alignment to be supported by sh::shared_ptr.
 	 */
-	constexpr std::size_t max_alignment{ alignof(std::max_align_t) };
+#if SH_POINTER_COMPACT_CONTROL
+	inline constexpr std::size_t max_alignment{ alignof(std::uint64_t) };
+#else // !SH_POINTER_COMPACT_CONTROL
+	inline constexpr std::size_t max_alignment{ alignof(std::max_align_t) };
+#endif // !SH_POINTER_COMPACT_CONTROL
 
 	// Cast tag types:
 	struct const_cast_tag {};
@@ -137,6 +288,7 @@ namespace sh::pointer
 	{
 		using destruct_type = void(*)(class control*) noexcept;
 		using deallocate_type = void(*)(class control*) noexcept;
+		using destruct_deallocate_type = void(*)(class control*) noexcept;
 		using get_deleter_type = void*(*)(class control*) noexcept;
 
 		/**	Called with the control block to destruct associated value(s).
@@ -147,140 +299,1562 @@ namespace sh::pointer
 		 */
 		deallocate_type m_deallocate;
 
+		/**	Called with the control block to destruct associated value(s) & then deallocate, upon release of the last
+		 *	reference. Fuses m_destruct & m_deallocate into one indirect call, skipping destruction entirely where it
+		 *	would do nothing.
+		 */
+		destruct_deallocate_type m_destruct_deallocate;
+
 		/**	Called with the control block to return a pointer to a deleter.
 		 */
 		get_deleter_type m_get_deleter{ nullptr };
 
-#if SH_POINTER_DEBUG_SHARED_PTR
-		using get_element_count_type = std::size_t(*)(const class control*) noexcept;
+#if SH_POINTER_PROFILE
+		using get_origin_type = const char*(*)() noexcept;
 
-		/**	Called with the control block to return the number of elements controlled.
+		/**	For profiling, return a pointer to a static string identifying the type of control block.
 		 */
-		get_element_count_type m_get_element_count{ nullptr };
-#endif // SH_POINTER_DEBUG_SHARED_PTR
+		get_origin_type m_get_origin{ nullptr };
+#endif // SH_POINTER_PROFILE
+
+#if SH_POINTER_BIASED_COUNT
+		/**	The offset in bytes from the control block to its control_bias, or zero if not biased.
+		 */
+		std::size_t m_bias_offset{ 0 };
+#endif // SH_POINTER_BIASED_COUNT
+
+#if SH_POINTER_COMPACT_CONTROL
+		/**	The index of this in control_operations_table, or zero until first used by a control block.
+		 */
+		mutable std::atomic<std::uint16_t> m_index{ 0 };
+#endif // SH_POINTER_COMPACT_CONTROL
+	};
+
+#if SH_POINTER_COMPACT_CONTROL
+	/**	The global table of control_operations indexed by compact control blocks.
+	 */
+	class control_operations_table final
+	{
+	public:
+		/**	The number of bits of a compact control block's counter holding its index.
+		 */
+		static constexpr unsigned index_bits{ 14 };
+		/**	The number of control_operations that may be indexed, including the unused zero index.
+		 */
+		static constexpr std::size_t capacity{ std::size_t{ 1 } << index_bits };
+
+		/**	Return the index of a control_operations, adding it to the table upon first use.
+		 *	@param operations The control_operations, which must have static storage duration.
+		 *	@return The index.
+		 */
+		static std::uint16_t index_of(const control_operations& operations) noexcept
+		{
+			const std::uint16_t index{ operations.m_index.load(std::memory_order_acquire) };
+			return index != 0 ? index : add(operations);
+		}
+		/**	Return the control_operations at an index returned by index_of.
+		 *	@param index The index.
+		 *	@return The control_operations.
+		 */
+		static const control_operations& at(const std::size_t index) noexcept
+		{
+			return *entries()[index];
+		}
+
+	private:
+		/**	Add a control_operations to the table.
+		 *	@note Calls std::terminate if the table is full.
+		 */
+		static std::uint16_t add(const control_operations& operations) noexcept
+		{
+			static std::atomic<std::size_t> next{ 1 };
+			const std::size_t index{ next.fetch_add(1, std::memory_order_relaxed) };
+			SH_POINTER_ASSERT(index < capacity,
+				"More control_operations than control_operations_table can index.");
+			if (index >= capacity)
+			{
+				std::terminate();
+			}
+			entries()[index] = &operations;
+			// If another thread added the same operations concurrently, use its index & leave this unused:
+			std::uint16_t expected{ 0 };
+			if (operations.m_index.compare_exchange_strong(expected, std::uint16_t(index), std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				return std::uint16_t(index);
+			}
+			return expected;
+		}
+		/**	Return the table's entries.
+		 */
+		static const control_operations** entries() noexcept
+		{
+			static const control_operations* instance[capacity]{};
+			return instance;
+		}
+	};
+#endif // SH_POINTER_COMPACT_CONTROL
+
+	/**	True if Alloc's destroy of a T does nothing, so may be skipped. This holds for trivially destructible T unless
+	 *	Alloc declares its own destroy, in which case specialize this for allocators whose destroy only destructs.
+	 */
+	template <typename Alloc, typename T>
+	inline constexpr bool is_destroy_trivial_v{ std::is_trivially_destructible_v<T>
+		&& false == requires(Alloc& alloc, T* const p) { alloc.destroy(p); } };
+
+	/**	True if Alloc's rebinds to different value types all allocate from the same source, such that memory allocated
+	 *	by a rebind to one type may be deallocated by a rebind to another type of the same size & alignment. Specialize
+	 *	this for such allocators to let values share control operations (see SH_POINTER_SHARE_OPERATIONS), which is
+	 *	limited to empty allocators.
+	 */
+	template <typename Alloc>
+	inline constexpr bool is_rebind_agnostic_v{ false };
+	template <typename U>
+	inline constexpr bool is_rebind_agnostic_v<std::allocator<U>>{ true };
+
+	/**	Trivially destructible stand-in for values of the given size & alignment, whose control operations are shared.
+	 *	@tparam Size The size of the value.
+	 *	@tparam Alignment The alignment of the value.
+	 */
+	template <std::size_t Size, std::size_t Alignment>
+	struct alignas(Alignment) trivial_value final
+	{
+		std::byte m_bytes[Size];
 	};
 
+	/**	True if T derives from sh::weak_free.
+	 */
+	template <typename T>
+	inline constexpr bool is_weak_free_v{ std::is_convertible_v<T*, const volatile weak_free*> };
+
 	using use_count_t = std::uint32_t;
+	/**	The use_count reported for a value owned by an immortal control block (see sh::make_immortal_shared).
+	 */
+	inline constexpr use_count_t immortal_use_count{ std::numeric_limits<use_count_t>::max() };
 
-	/**	A control block containing shared & weak reference counts and access to destruction & deallocation operations.
+#if SH_POINTER_BIASED_COUNT
+	class control_bias;
+
+	/**	A thread to which control blocks may be biased. Each thread's bias_owner is created upon its first biased
+	 *	allocation & lives until both the thread has exited & no control blocks biased to it remain allocated.
+	 *	@detail Other threads that release references counted by the owning thread queue the control block to it,
+	 *		and the owning thread merges its biased count into the shared count the next time it releases a biased
+	 *		reference, calls merge, or exits. After exit, other threads merge on their own.
 	 */
-	class control
+	class bias_owner final
 	{
 	public:
-		/**	The counter type used for combined shared (value + control) & weak (control) reference counts.
+		bias_owner(const bias_owner&) = delete;
+		bias_owner& operator=(const bias_owner&) = delete;
+
+		/**	Return the calling thread's bias_owner, creating it upon first use.
+		 *	@throw std::bad_alloc If creation fails.
+		 *	@return The calling thread's bias_owner.
 		 */
-		using counter_t = std::uint_fast64_t;
-		/**	Equal to a single counter_t reference on a control block.
+		static bias_owner& current()
+		{
+			thread_owner& owner = get_thread_owner();
+			if (owner.m_owner == nullptr)
+			{
+				owner.m_owner = new bias_owner{};
+			}
+			return *owner.m_owner;
+		}
+		/**	Return the calling thread's bias_owner or nullptr if it has none.
 		 */
-		static constexpr counter_t control_one = 1ull << (sizeof(counter_t) * CHAR_BIT >> 1);
-		/**	Equal to a single counter_t reference on an associated value.
+		static bias_owner* current_if_any() noexcept
+		{
+			return get_thread_owner().m_owner;
+		}
+		/**	Merge the biased counts of control blocks queued to the calling thread, destroying those no longer
+		 *	referenced. Threads that rarely release biased references may call this periodically.
 		 */
-		static constexpr counter_t value_one = 1ull;
-		/**	Equal to a single counter_t reference for a weak_ptr.
+		static void merge() noexcept
+		{
+			if (bias_owner* const owner = current_if_any())
+			{
+				owner->merge_queued();
+			}
+		}
+
+	private:
+		friend class control;
+		friend class control_bias;
+
+		/**	The calling thread's bias_owner, released at thread exit.
 		 */
-		static constexpr counter_t weak_one{ control_one };
-		/**	Equal to a single counter_t reference for a shared_ptr.
+		struct thread_owner final
+		{
+			~thread_owner();
+			bias_owner* m_owner{ nullptr };
+		};
+
+		/**	The value of m_queue once the owning thread has exited.
 		 */
-		static constexpr counter_t shared_one{ control_one | value_one };
+		static constexpr std::uintptr_t closed{ 1 };
 
-		/**	Return the number of shared_one references in a given counter value.
-		 *	@param counter The initial counter value.
-		 *	@param operations The control operations to which a pointer is stored.
+		bias_owner() noexcept = default;
+		~bias_owner() = default;
+
+		static thread_owner& get_thread_owner() noexcept
+		{
+			thread_local thread_owner instance;
+			return instance;
+		}
+
+		void add_ref() noexcept
+		{
+			m_refs.fetch_add(1, std::memory_order_relaxed);
+		}
+		void release() noexcept
+		{
+			if (m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				delete this;
+			}
+		}
+		bool has_queued() const noexcept
+		{
+			return m_queue.load(std::memory_order_relaxed) != 0;
+		}
+		/**	Queue a control block for the owning thread to merge.
+		 *	@param bias The control block's bias.
+		 *	@return True if queued. False if the owning thread has exited.
+		 */
+		bool push(control_bias& bias) noexcept;
+		/**	Merge all control blocks queued thus far.
+		 *	@param replacement The value to leave in m_queue: zero, or closed upon exit.
+		 */
+		void merge_queued(const std::uintptr_t replacement = 0) noexcept;
+
+		/**	Intrusive stack of queued control_bias, zero if empty, or closed.
+		 */
+		std::atomic<std::uintptr_t> m_queue{ 0 };
+		/**	References from the owning thread & each control block biased to it.
+		 */
+		std::atomic<std::size_t> m_refs{ 1 };
+	};
+
+	/**	The biased reference counting state of a control block created by make_shared_biased.
+	 *	@detail The control block's own counter holds a single shared reference on behalf of this state, released once
+	 *		both counts merge & reach zero. Until merged, the owning thread counts in m_biased, which is only modified
+	 *		by the owning thread. Other threads count in m_shared, which may become negative when they release
+	 *		references the owning thread counted.
+	 */
+	class control_bias final
+	{
+	public:
+		/**	Construct a bias toward the calling thread holding a single reference.
+		 *	@param ctrl The control block with which this is associated.
+		 *	@param owner The calling thread's bias_owner.
+		 */
+		control_bias(control& ctrl, bias_owner* const owner) noexcept
+			: m_ctrl{ &ctrl }
+			, m_owner{ owner }
+		{
+			owner->add_ref();
+		}
+		~control_bias()
+		{
+			m_owner->release();
+		}
+		control_bias(const control_bias&) = delete;
+		control_bias& operator=(const control_bias&) = delete;
+
+	private:
+		friend class control;
+		friend class bias_owner;
+
+		using shared_t = std::int64_t;
+
+		/**	Set in m_shared once m_biased is merged into it, after which all threads count in m_shared.
+		 */
+		static constexpr shared_t merged_bit{ 0b01 };
+		/**	Set in m_shared once queued to m_owner for merging.
+		 */
+		static constexpr shared_t queued_bit{ 0b10 };
+		/**	Equal to a single reference in m_shared.
+		 */
+		static constexpr shared_t shared_one{ 0b100 };
+
+		static constexpr shared_t to_shared_count(const shared_t shared) noexcept
+		{
+			return shared >> 2;
+		}
+
+		/**	The associated control block.
+		 */
+		control* const m_ctrl;
+		/**	The thread toward which counting is biased.
+		 */
+		bias_owner* const m_owner;
+		/**	References counted by the owning thread. Atomic only to allow use_count from other threads.
+		 */
+		std::atomic<use_count_t> m_biased{ 1 };
+		/**	References counted by other threads, in units of shared_one, along with merged_bit & queued_bit.
+		 */
+		std::atomic<shared_t> m_shared{ 0 };
+		/**	The next control_bias queued to m_owner.
+		 */
+		control_bias* m_next_queued{ nullptr };
+	};
+#endif // SH_POINTER_BIASED_COUNT
+
+#if SH_POINTER_SPECIAL_COUNT
+	/**	Shared reference counts spread across cache line separated shards, allocated immediately before the control
+	 *	block of a value created by make_sharded_shared. Each shard counts references taken by the threads assigned
+	 *	to it & is never negative. Once collapsed, all counting moves to the control block.
+	 */
+	struct control_shards final
+	{
+		using shard_count_t = std::uint64_t;
+
+		/**	Set in each shard once collapsed, after which its count is ignored.
+		 */
+		static constexpr shard_count_t collapsed_bit{ 1ull << (sizeof(shard_count_t) * CHAR_BIT - 1) };
+		/**	The number of shards.
+		 */
+		static constexpr std::size_t shard_count{ SH_POINTER_SHARD_COUNT };
+		static_assert(shard_count > 0, "SH_POINTER_SHARD_COUNT must be positive.");
+
+		/**	A shard count padded to a cache line.
+		 */
+		struct shard final
+		{
+			/**	The number of shared references counted by this shard, along with collapsed_bit.
+			 */
+			std::atomic<shard_count_t> m_count{ 0 };
+			/**	Padding to separate m_count from the next shard's.
+			 */
+			std::byte m_padding[SH_POINTER_CACHE_LINE_SIZE - sizeof(std::atomic<shard_count_t>)];
+		};
+
+		/**	Return the index of the shard assigned to the calling thread.
+		 */
+		static std::size_t local_index() noexcept
+		{
+			static std::atomic<std::size_t> next{ 0 };
+			thread_local const std::size_t index{ next.fetch_add(1, std::memory_order_relaxed) % shard_count };
+			return index;
+		}
+		/**	Return the number of shared references counted by uncollapsed shards.
+		 *	@note Counts may change immediately after returning.
+		 */
+		shard_count_t count() const noexcept
+		{
+			shard_count_t total{ 0 };
+			for (const shard& each : m_shards)
+			{
+				const shard_count_t value{ each.m_count.load(std::memory_order_relaxed) };
+				if ((value & collapsed_bit) == 0)
+				{
+					total += value;
+				}
+			}
+			return total;
+		}
+
+		/**	The shards.
+		 */
+		shard m_shards[shard_count];
+	};
+#endif // SH_POINTER_SPECIAL_COUNT
+
+#if SH_POINTER_DEBUG_SHARED_PTR
+	/**	For debug validation, the state of a control block kept by control_validation.
+	 */
+	struct control_state final
+	{
+		/**	A pointer to a static string identifying where the control block originated.
+		 */
+		const char* m_origin{ nullptr };
+		/**	The number of elements controlled, or SIZE_MAX if unknown.
+		 */
+		std::size_t m_element_count{ std::numeric_limits<std::size_t>::max() };
+		/**	True once the associated data has been destructed.
+		 */
+		bool m_destructed{ false };
+		/**	The thread allowed to count references locally, if any.
+		 */
+		std::thread::id m_local_thread{};
+	};
+
+	/**	For debug validation, a side table of control_state keyed by control block address, sharded by address with a
+	 *	mutex per shard.
+	 *	@detail Only control blocks sampled upon allocation are validated, one per sample_rate allocated. The state of
+	 *		each is erased upon its deallocation, which consequently can't be checked for repetition.
+	 */
+	class control_validation final
+	{
+	public:
+		/**	The number of shards across which states are spread, each with its own mutex.
+		 */
+		static constexpr std::size_t shard_count{ 64 };
+
+		/**	Set the number of control blocks allocated per one validated. Those already validated remain so.
+		 *	@param rate The number of allocations per validation: one validates all, zero none.
+		 */
+		static void set_sample_rate(const std::size_t rate) noexcept
+		{
+			global().m_sample_rate.store(rate, std::memory_order_relaxed);
+		}
+		/**	Return the number of control blocks allocated per one validated, or zero if none are.
+		 *	@return The sample rate.
+		 */
+		static std::size_t sample_rate() noexcept
+		{
+			return global().m_sample_rate.load(std::memory_order_relaxed);
+		}
+		/**	Return the number of control blocks being validated.
+		 *	@note May change immediately after returning.
+		 *	@return The number of control blocks with a state.
+		 */
+		static std::size_t size() noexcept
+		{
+			return global().m_size.load(std::memory_order_relaxed);
+		}
+
+		/**	Begin validating a newly allocated control block, if sampled.
+		 *	@param ctrl The control block.
+		 *	@param origin The origin to later check against.
+		 *	@param element_count The number of elements controlled, or SIZE_MAX if unknown.
+		 */
+		static void insert(const void* const ctrl, const char* const origin, const std::size_t element_count) noexcept
+		{
+			control_validation& instance = global();
+			const std::size_t rate{ instance.m_sample_rate.load(std::memory_order_relaxed) };
+			if (rate == 0 || instance.m_allocations.fetch_add(1, std::memory_order_relaxed) % rate != 0)
+			{
+				return;
+			}
+			shard& each = instance.shard_of(ctrl);
+			const std::lock_guard<std::mutex> lock{ each.m_mutex };
+			try
+			{
+				const auto [iter, inserted] = each.m_states.try_emplace(ctrl);
+				SH_POINTER_ASSERT(inserted,
+					"Changing control block origin a second time.");
+				iter->second.m_origin = origin;
+				iter->second.m_element_count = element_count;
+				if (inserted)
+				{
+					instance.m_size.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			catch (...)
+			{
+				// If the state can't be allocated, leave the control block unvalidated.
+			}
+		}
+		/**	Stop validating a control block, if validated.
+		 *	@param ctrl The control block.
+		 */
+		static void erase(const void* const ctrl) noexcept
+		{
+			control_validation& instance = global();
+			if (instance.m_size.load(std::memory_order_relaxed) == 0)
+			{
+				return;
+			}
+			shard& each = instance.shard_of(ctrl);
+			const std::lock_guard<std::mutex> lock{ each.m_mutex };
+			if (each.m_states.erase(ctrl) != 0)
+			{
+				instance.m_size.fetch_sub(1, std::memory_order_relaxed);
+			}
+		}
+		/**	Call a function with the state of a control block while holding its shard's mutex, if validated.
+		 *	@param ctrl The control block.
+		 *	@param function The function, called with a control_state&.
+		 */
+		template <typename Function>
+		static void visit(const void* const ctrl, Function&& function) noexcept
+		{
+			control_validation& instance = global();
+			if (instance.m_size.load(std::memory_order_relaxed) == 0)
+			{
+				return;
+			}
+			shard& each = instance.shard_of(ctrl);
+			const std::lock_guard<std::mutex> lock{ each.m_mutex };
+			const auto iter = each.m_states.find(ctrl);
+			if (iter != each.m_states.end())
+			{
+				function(iter->second);
+			}
+		}
+
+	private:
+		/**	States of the control blocks whose addresses hash to one shard.
+		 */
+		struct alignas(SH_POINTER_CACHE_LINE_SIZE) shard final
+		{
+			std::mutex m_mutex;
+			std::unordered_map<const void*, control_state> m_states;
+		};
+
+		/**	Return the side table.
+		 *	@return A reference to the instance, which is never destroyed such that objects with static storage
+		 *		duration may safely release control blocks during their own destruction.
+		 */
+		static control_validation& global() noexcept
+		{
+			static control_validation* const instance = new control_validation{};
+			return *instance;
+		}
+		/**	Return the shard holding the state of a control block.
+		 *	@param ctrl The control block.
+		 *	@return The shard.
+		 */
+		shard& shard_of(const void* const ctrl) noexcept
+		{
+			// Fibonacci hashing spreads addresses whose low bits are zeroed by alignment.
+			const std::uint64_t hash{ std::uint64_t(reinterpret_cast<std::uintptr_t>(ctrl)) * 0x9E3779B97F4A7C15ull };
+			return m_shards[(hash >> 32) % shard_count];
+		}
+
+		/**	The number of control blocks allocated per one validated.
+		 */
+		std::atomic<std::size_t> m_sample_rate{ SH_POINTER_VALIDATE_SAMPLE_RATE };
+		/**	The number of control blocks allocated, for sampling.
+		 */
+		std::atomic<std::size_t> m_allocations{ 0 };
+		/**	The number of states across all shards, allowing validation to be skipped while there are none.
+		 */
+		std::atomic<std::size_t> m_size{ 0 };
+		/**	The shards.
+		 */
+		shard m_shards[shard_count];
+	};
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+#if SH_POINTER_PROFILE
+	/**	For profiling, the reference count operations sampled on one control block.
+	 */
+	struct control_samples final
+	{
+		/**	A pointer to a static string identifying the type of control block (see origin functions).
+		 */
+		const char* m_origin{ nullptr };
+		/**	The number of operations sampled.
+		 */
+		std::size_t m_samples{ 0 };
+		/**	The number of operations sampled on a different thread than the previous sample, each a likely transfer of
+		 *	the cache line holding the reference count between cores.
+		 */
+		std::size_t m_transfers{ 0 };
+		/**	The thread of the previous sample.
+		 */
+		std::thread::id m_last_thread{};
+	};
+
+	/**	For profiling, a side table of control_samples keyed by control block address, sharded by address with a mutex
+	 *	per shard.
+	 *	@detail Each thread records one of every sample_rate of its reference count operations. Samples are kept after
+	 *		a control block is deallocated, until reset, & are restarted if its address is reused by another type.
+	 */
+	class control_profile final
+	{
+	public:
+		/**	The number of shards across which samples are spread, each with its own mutex.
+		 */
+		static constexpr std::size_t shard_count{ 64 };
+
+		/**	Set the number of reference count operations by each thread per one recorded.
+		 *	@param rate The number of operations per sample: one records all, zero none.
+		 */
+		static void set_sample_rate(const std::size_t rate) noexcept
+		{
+			global().m_sample_rate.store(rate, std::memory_order_relaxed);
+		}
+		/**	Return the number of reference count operations by each thread per one recorded, or zero if none are.
+		 *	@return The sample rate.
+		 */
+		static std::size_t sample_rate() noexcept
+		{
+			return global().m_sample_rate.load(std::memory_order_relaxed);
+		}
+
+		/**	Return true if the calling thread's current reference count operation should be recorded.
+		 *	@return True if sampled.
+		 */
+		static bool sampled() noexcept
+		{
+			const std::size_t rate{ global().m_sample_rate.load(std::memory_order_relaxed) };
+			if (rate == 0)
+			{
+				return false;
+			}
+			thread_local std::size_t operations{ 0 };
+			return ++operations % rate == 0;
+		}
+		/**	Record a sampled reference count operation by the calling thread.
+		 *	@param ctrl The control block.
+		 *	@param origin The type of control block.
+		 */
+		static void record(const void* const ctrl, const char* const origin) noexcept
+		{
+			control_profile& instance = global();
+			const std::thread::id thread{ std::this_thread::get_id() };
+			shard& each = instance.shard_of(ctrl);
+			const std::lock_guard<std::mutex> lock{ each.m_mutex };
+			try
+			{
+				control_samples& samples = each.m_samples[ctrl];
+				if (samples.m_origin != origin)
+				{
+					samples = control_samples{ origin };
+				}
+				else if (samples.m_last_thread != thread)
+				{
+					++samples.m_transfers;
+				}
+				++samples.m_samples;
+				samples.m_last_thread = thread;
+			}
+			catch (...)
+			{
+				// If the samples can't be allocated, drop this one.
+			}
+		}
+
+		/**	Return a copy of the samples of every control block recorded.
+		 *	@throw May throw std::bad_alloc.
+		 *	@return The control block addresses & their samples.
+		 */
+		static std::vector<std::pair<const void*, control_samples>> snapshot()
+		{
+			control_profile& instance = global();
+			std::vector<std::pair<const void*, control_samples>> result;
+			for (shard& each : instance.m_shards)
+			{
+				const std::lock_guard<std::mutex> lock{ each.m_mutex };
+				result.insert(result.end(), each.m_samples.begin(), each.m_samples.end());
+			}
+			return result;
+		}
+		/**	Discard all samples recorded.
+		 */
+		static void reset() noexcept
+		{
+			control_profile& instance = global();
+			for (shard& each : instance.m_shards)
+			{
+				const std::lock_guard<std::mutex> lock{ each.m_mutex };
+				each.m_samples.clear();
+			}
+		}
+
+	private:
+		/**	Samples of the control blocks whose addresses hash to one shard.
+		 */
+		struct alignas(SH_POINTER_CACHE_LINE_SIZE) shard final
+		{
+			std::mutex m_mutex;
+			std::unordered_map<const void*, control_samples> m_samples;
+		};
+
+		/**	Return the side table.
+		 *	@return A reference to the instance, which is never destroyed such that objects with static storage
+		 *		duration may safely count references during their own destruction.
+		 */
+		static control_profile& global() noexcept
+		{
+			static control_profile* const instance = new control_profile{};
+			return *instance;
+		}
+		/**	Return the shard holding the samples of a control block.
+		 *	@param ctrl The control block.
+		 *	@return The shard.
+		 */
+		shard& shard_of(const void* const ctrl) noexcept
+		{
+			// Fibonacci hashing spreads addresses whose low bits are zeroed by alignment.
+			const std::uint64_t hash{ std::uint64_t(reinterpret_cast<std::uintptr_t>(ctrl)) * 0x9E3779B97F4A7C15ull };
+			return m_shards[(hash >> 32) % shard_count];
+		}
+
+		/**	The number of reference count operations by each thread per one recorded.
+		 */
+		std::atomic<std::size_t> m_sample_rate{ SH_POINTER_PROFILE_SAMPLE_RATE };
+		/**	The shards.
+		 */
+		shard m_shards[shard_count];
+	};
+
+	/**	Write the control blocks & types whose sampled reference count operations most often came from a different
+	 *	thread than the previous sample (transfers), then most often overall.
+	 *	@detail Types are named by the mangled name of their control block's class, which c++filt can demangle. Values
+	 *		with many transfers are candidates for sh::make_immortal_shared or sh::make_sharded_shared.
+	 *	@param out The stream to write to.
+	 *	@param top_count The number of control blocks & of types to list.
+	 */
+	inline void profile_report(std::ostream& out = std::clog, const std::size_t top_count = 10)
+	{
+		struct type_samples final
+		{
+			const char* m_origin;
+			std::size_t m_samples;
+			std::size_t m_transfers;
+			std::size_t m_objects;
+		};
+
+		std::vector<std::pair<const void*, control_samples>> objects = control_profile::snapshot();
+		std::vector<type_samples> types;
+		std::size_t total{ 0 };
+		for (const auto& [ctrl, samples] : objects)
+		{
+			total += samples.m_samples;
+			const auto type = std::find_if(types.begin(), types.end(),
+				[&samples](const type_samples& each) noexcept -> bool { return each.m_origin == samples.m_origin; });
+			if (type == types.end())
+			{
+				types.push_back(type_samples{ samples.m_origin, samples.m_samples, samples.m_transfers, 1 });
+			}
+			else
+			{
+				type->m_samples += samples.m_samples;
+				type->m_transfers += samples.m_transfers;
+				++type->m_objects;
+			}
+		}
+		const auto hotter = [](const auto& lhs, const auto& rhs) noexcept -> bool
+		{
+			return lhs.m_transfers != rhs.m_transfers ? lhs.m_transfers > rhs.m_transfers : lhs.m_samples > rhs.m_samples;
+		};
+		std::sort(objects.begin(), objects.end(),
+			[&hotter](const auto& lhs, const auto& rhs) noexcept -> bool { return hotter(lhs.second, rhs.second); });
+		std::sort(types.begin(), types.end(), hotter);
+
+		out << "sh::pointer profile: " << total << " samples of 1 per " << control_profile::sample_rate()
+			<< " reference count operations\n";
+		out << "Hottest control blocks:\n"
+			<< std::setw(12) << "transfers" << std::setw(12) << "samples" << "  " << std::setw(18) << std::left << "control"
+			<< std::right << "  type\n";
+		for (std::size_t index = 0; index < objects.size() && index < top_count; ++index)
+		{
+			const auto& [ctrl, samples] = objects[index];
+			out << std::setw(12) << samples.m_transfers << std::setw(12) << samples.m_samples << "  "
+				<< std::setw(18) << std::left << ctrl << std::right << "  " << samples.m_origin << '\n';
+		}
+		out << "Hottest types:\n"
+			<< std::setw(12) << "transfers" << std::setw(12) << "samples" << std::setw(12) << "objects" << "  type\n";
+		for (std::size_t index = 0; index < types.size() && index < top_count; ++index)
+		{
+			const type_samples& type = types[index];
+			out << std::setw(12) << type.m_transfers << std::setw(12) << type.m_samples << std::setw(12) << type.m_objects
+				<< "  " << type.m_origin << '\n';
+		}
+	}
+#endif // SH_POINTER_PROFILE
+
+	/**	A control block containing shared & weak reference counts and access to destruction & deallocation operations.
+	 */
+	class control
+	{
+	public:
+		/**	The counter type used for combined shared (value + control) & weak (control) reference counts.
+		 */
+		using counter_t = std::uint_fast64_t;
+#if SH_POINTER_COMPACT_CONTROL
+		/**	The number of bits counting value references, followed by as many counting control references & then
+		 *	control_operations_table::index_bits of the index of this control block's operations.
+		 */
+		static constexpr unsigned count_bits{ 24 };
+		/**	The bit offset of the index of this control block's operations.
+		 */
+		static constexpr unsigned index_shift{ count_bits * 2 };
+		/**	Bits of m_counter that never change after construction, excluded from comparisons of counts.
+		 */
+		static constexpr counter_t fixed_bits{ ((counter_t{ 1 } << control_operations_table::index_bits) - 1) << index_shift };
+		static_assert(index_shift + control_operations_table::index_bits <= sizeof(counter_t) * CHAR_BIT - 2,
+			"Operations index overlaps immortal_bit or sharded_bit.");
+#else // !SH_POINTER_COMPACT_CONTROL
+		/**	The number of bits counting value references, followed by those counting control references.
+		 */
+		static constexpr unsigned count_bits{ sizeof(counter_t) * CHAR_BIT >> 1 };
+		/**	Bits of m_counter that never change after construction, excluded from comparisons of counts.
+		 */
+		static constexpr counter_t fixed_bits{ 0 };
+#endif // !SH_POINTER_COMPACT_CONTROL
+		/**	Equal to a single counter_t reference on a control block.
+		 */
+		static constexpr counter_t control_one = 1ull << count_bits;
+		/**	Equal to a single counter_t reference on an associated value.
+		 */
+		static constexpr counter_t value_one = 1ull;
+		/**	Equal to a single counter_t reference for a weak_ptr.
+		 */
+		static constexpr counter_t weak_one{ control_one };
+		/**	Equal to a single counter_t reference for a shared_ptr.
+		 */
+		static constexpr counter_t shared_one{ control_one | value_one };
+		/**	Set in m_counter of an immortal control block, whose counter is never modified & whose value is never
+		 *	destructed. Limits control references to half those that counter_t would otherwise hold.
+		 */
+		static constexpr counter_t immortal_bit = 1ull << (sizeof(counter_t) * CHAR_BIT - 1);
+		/**	Set in m_counter of a sharded control block, which is preceded by control_shards, until collapsed. Limits
+		 *	control references as immortal_bit does.
+		 */
+		static constexpr counter_t sharded_bit = 1ull << (sizeof(counter_t) * CHAR_BIT - 2);
+		/**	Bits in m_counter which divert shared reference counting from the usual atomic read-modify-writes.
+		 */
+		static constexpr counter_t special_bits{ immortal_bit | sharded_bit };
+
+		/**	Return the number of shared_one references in a given counter value.
+		 *	@param counter The initial counter value.
+		 *	@param operations The control operations to which a pointer is stored.
+		 */
+		control(const counter_t counter, const control_operations& operations) noexcept
+#if SH_POINTER_COMPACT_CONTROL
+			: m_counter{ counter | (counter_t{ control_operations_table::index_of(operations) } << index_shift) }
+#else // !SH_POINTER_COMPACT_CONTROL
+			: m_counter{ counter }
+			, m_operations{ &operations }
+#endif // !SH_POINTER_COMPACT_CONTROL
+		{ }
+		control() = delete;
+		control(const control&) = delete;
+		control& operator=(const control&) = delete;
+
+		/**	Return the number of value_one references in a given counter value.
+		 *	@param counter The counter from which to extract a shared_one reference count.
+		 *	@return The number of value_one references in the given counter.
+		 */
+		static constexpr std::uint32_t to_value_count(const counter_t counter) noexcept
+		{
+			// Mask to remove control bits and retain value bits.
+			return std::uint32_t(counter & (control_one - 1));
+		}
+		/**	Return the reference counts in a given counter value, excluding fixed_bits.
+		 *	@param counter The counter value.
+		 *	@return The counter value without fixed_bits.
+		 */
+		static constexpr counter_t to_counts(const counter_t counter) noexcept
+		{
+			return counter & ~fixed_bits;
+		}
+		/**	Return the number of shared_one references.
+		 *	@detail Used by shared_ptr::use_count, weak_ptr::use_count, and weak_ptr::expired.
+		 *	@note Stored count may change immediately after returning
+		 *	@return The number of shared_one references or immortal_use_count if immortal.
+		 */
+		use_count_t get_shared_count() const noexcept
+		{
+#if SH_POINTER_BIASED_COUNT
+			if (const control_bias* const bias = get_bias())
+			{
+				return bias_get_count(*bias);
+			}
+#endif // SH_POINTER_BIASED_COUNT
+			const counter_t counter{ m_counter.load(std::memory_order_relaxed) };
+#if SH_POINTER_SPECIAL_COUNT
+			if (counter & immortal_bit)
+			{
+				return immortal_use_count;
+			}
+			if (counter & sharded_bit)
+			{
+				return use_count_t(to_value_count(counter) + get_shards().count());
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+			// Each value count can only be from a shared count.
+			return use_count_t{ to_value_count(counter) };
+		}
+#if SH_POINTER_SPECIAL_COUNT
+		/**	Return true if this control block is immortal.
+		 *	@detail Immortal control blocks are never modified after make_immortal, so this only reads a cache line
+		 *		that may be shared by all cores.
+		 */
+		bool is_immortal() const noexcept
+		{
+			return (m_counter.load(std::memory_order_relaxed) & immortal_bit) != 0;
+		}
+		/**	Make this control block immortal, after which reference counting is skipped & its value(s) are never
+		 *	destructed nor deallocated.
+		 *	@note Must be called before any other thread can access this control block.
+		 */
+		void make_immortal() noexcept
+		{
+#if SH_POINTER_BIASED_COUNT
+			SH_POINTER_ASSERT(get_bias() == nullptr,
+				"Biased control blocks can't be made immortal.");
+#endif // SH_POINTER_BIASED_COUNT
+			m_counter.store((m_counter.load(std::memory_order_relaxed) & fixed_bits) | immortal_bit | shared_one, std::memory_order_relaxed);
+		}
+#endif // SH_POINTER_SPECIAL_COUNT
+		/**	Increment counter by shared_one.
+		 *	@detail Used by shared_ptr.
+		 */
+		void shared_inc() noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_SPECIAL_COUNT
+			if (const counter_t special{ m_counter.load(std::memory_order_relaxed) & special_bits })
+			{
+				if (special == sharded_bit)
+				{
+					shard_inc(1);
+				}
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+#if SH_POINTER_BIASED_COUNT
+			if (control_bias* const bias = get_bias())
+			{
+				bias_inc(*bias, 1);
+				return;
+			}
+#endif // SH_POINTER_BIASED_COUNT
+			m_counter.fetch_add(shared_one, std::memory_order_relaxed);
+		}
+		/**	Decrement counter by shared_one. Calls destruct & deallocate if this was the last reference. Calls destruct if the last shared_one reference.
+		 *	@detail Used by shared_ptr.
+		 */
+		void shared_dec() noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_SPECIAL_COUNT
+			if (const counter_t special{ m_counter.load(std::memory_order_relaxed) & special_bits })
+			{
+				if (special == sharded_bit)
+				{
+					shard_dec(1);
+				}
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+#if SH_POINTER_BIASED_COUNT
+			if (control_bias* const bias = get_bias())
+			{
+				bias_dec(*bias, 1);
+				return;
+			}
+#endif // SH_POINTER_BIASED_COUNT
+			counter_shared_dec();
+		}
+		/**	Increment counter by \p count shared_one references.
+		 *	@detail Used by atomic shared_ptr to transfer references borrowed by concurrent loads.
+		 *	@param count The number of shared_one references to add.
+		 */
+		void shared_inc(const use_count_t count) noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_SPECIAL_COUNT
+			if (const counter_t special{ m_counter.load(std::memory_order_relaxed) & special_bits })
+			{
+				if (special == sharded_bit)
+				{
+					shard_inc(count);
+				}
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+#if SH_POINTER_BIASED_COUNT
+			if (control_bias* const bias = get_bias())
+			{
+				bias_inc(*bias, count);
+				return;
+			}
+#endif // SH_POINTER_BIASED_COUNT
+			m_counter.fetch_add(shared_one * count, std::memory_order_relaxed);
+		}
+		/**	Decrement counter by \p count shared_one references. Calls destruct & deallocate if these were the last references. Calls destruct if these were the last shared_one references.
+		 *	@detail Used by atomic shared_ptr to release references borrowed by concurrent loads.
+		 *	@param count The number of shared_one references to remove.
+		 */
+		void shared_dec(const use_count_t count) noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_SPECIAL_COUNT
+			if (const counter_t special{ m_counter.load(std::memory_order_relaxed) & special_bits })
+			{
+				if (special == sharded_bit)
+				{
+					shard_dec(count);
+				}
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+#if SH_POINTER_BIASED_COUNT
+			if (control_bias* const bias = get_bias())
+			{
+				bias_dec(*bias, count);
+				return;
+			}
+#endif // SH_POINTER_BIASED_COUNT
+			counter_shared_dec(count);
+		}
+
+		/**	Increment counter by shared_one without checking special_bits nor bias.
+		 *	@detail Used by shared_ptr of weak-free types (see sh::weak_free), whose control blocks are never immortal,
+		 *		sharded, nor biased.
+		 */
+		void weak_free_shared_inc() noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+			m_counter.fetch_add(shared_one, std::memory_order_relaxed);
+		}
+		/**	Decrement counter by shared_one without checking special_bits nor bias. Calls destruct & deallocate if this was the last reference.
+		 *	@detail Used by shared_ptr of weak-free types (see sh::weak_free). As no weak references exist, the last
+		 *		shared_one reference is also the last control reference, so the value count needn't be checked apart.
+		 */
+		void weak_free_shared_dec() noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+			const counter_t previous{ m_counter.fetch_sub(shared_one, std::memory_order_release) };
+			SH_POINTER_ASSERT((previous & special_bits) == 0,
+				"Weak-free control block is immortal or sharded.");
+			if (to_counts(previous) == shared_one)
+			{
+				// Acquire if last reference control + value reference.
+				acquire_counter();
+				release_last();
+			}
+			else
+			{
+				SH_POINTER_ASSERT(to_value_count(previous) != 1u,
+					"Weak-free control block has weak references.");
+			}
+		}
+
+		/**	Enumeration of return values from shared_inc_if_nonzero.
+		 */
+		enum class shared_inc_if_nonzero_result : std::int8_t
+		{
+			/**	No change was made to control.
+			 */
+			no_inc,
+			/**	An increment of shared_one was added to control and the associated value is valid.
+			 */
+			added_shared_inc
+		};
+
+		/**	Try to increment counter by shared_one. Will only succeed if counter contains at least one increment of value_one.
+		 *	@detail Used by weak_ptr::lock.
+		 *	@return If a the counter was incremented by shared_one, added_shared_inc. If no increment was performed, no_inc.
+		 */
+		shared_inc_if_nonzero_result shared_inc_if_nonzero() noexcept
+		{
+#if SH_POINTER_SPECIAL_COUNT
+			if (const counter_t special{ m_counter.load(std::memory_order_relaxed) & special_bits })
+			{
+				return special == sharded_bit
+					? shard_inc_if_nonzero()
+					: shared_inc_if_nonzero_result::added_shared_inc;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+#if SH_POINTER_BIASED_COUNT
+			if (control_bias* const bias = get_bias())
+			{
+				return bias_inc_if_nonzero(*bias);
+			}
+#endif // SH_POINTER_BIASED_COUNT
+			return counter_shared_inc_if_nonzero();
+		}
+		/**	Decrement counter by value_one & call destruct if this was the last value reference.
+		 *	@detail Used by wide_weak_ptr when it must lock to cast to demote the wide_shared_ptr's reference from shared_one to control_one.
+		 */
+		void value_dec_for_shared_to_weak() noexcept
+		{
+#if SH_POINTER_SPECIAL_COUNT
+			if (const counter_t special{ m_counter.load(std::memory_order_relaxed) & special_bits })
+			{
+				if (special == sharded_bit)
+				{
+					weak_inc();
+					shard_dec(1);
+				}
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+#if SH_POINTER_BIASED_COUNT
+			if (control_bias* const bias = get_bias())
+			{
+				weak_inc();
+				bias_dec(*bias, 1);
+				return;
+			}
+#endif // SH_POINTER_BIASED_COUNT
+			const counter_t previous{ m_counter.fetch_sub(value_one, std::memory_order_release) };
+			if (to_value_count(previous) == 1u)
+			{
+				// Acquire if last value reference.
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				// If this was only the last value reference.
+				release_value();
+			}
+		}
+		/**	Increment counter by weak_one.
+		 *	@detail Used by weak_ptr.
+		 */
+		void weak_inc() noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_SPECIAL_COUNT
+			if (is_immortal())
+			{
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+			m_counter.fetch_add(weak_one, std::memory_order_relaxed);
+		}
+		/**	Decrement counter by weak_one & call deallocate if this was the last reference.
+		 *	@detail Used by weak_ptr.
+		 */
+		void weak_dec() noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+			// Before bothering with a store, check if we're the last
+			// reference. If so, no other weak or shared pointers could
+			// possibly be referencing this:
+			const counter_t counter{ m_counter.load(std::memory_order_acquire) };
+#if SH_POINTER_SPECIAL_COUNT
+			if (counter & immortal_bit)
+			{
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+			if (to_counts(counter) == weak_one)
+			{
+				// If this was the last control reference. Value destruction
+				// has already occurred, but deallocation is required.
+				get_operations().m_deallocate(this);
+			}
+			else
+			{
+				// No luck, do the decrement:
+				const counter_t previous{ m_counter.fetch_sub(weak_one, std::memory_order_release) };
+				if (to_counts(previous) == weak_one)
+				{
+					// Acquire if last control reference.
+					std::atomic_thread_fence(std::memory_order_acquire);
+
+					// If this was the last control reference. Value
+					// destruction has already occurred, but deallocation is
+					// required.
+					get_operations().m_deallocate(this);
+				}
+			}
+		}
+		/**	Increment counter by \p count weak_one references.
+		 *	@detail Used by atomic weak_ptr to transfer references borrowed by concurrent loads.
+		 *	@param count The number of weak_one references to add.
+		 */
+		void weak_inc(const use_count_t count) noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_SPECIAL_COUNT
+			if (is_immortal())
+			{
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+			m_counter.fetch_add(weak_one * count, std::memory_order_relaxed);
+		}
+		/**	Decrement counter by \p count weak_one references & call deallocate if these were the last references.
+		 *	@detail Used by atomic weak_ptr to release references borrowed by concurrent loads.
+		 *	@param count The number of weak_one references to remove.
+		 */
+		void weak_dec(const use_count_t count) noexcept
+		{
+#if SH_POINTER_PROFILE
+			profile();
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_SPECIAL_COUNT
+			if (is_immortal())
+			{
+				return;
+			}
+#endif // SH_POINTER_SPECIAL_COUNT
+			const counter_t decrement{ weak_one * count };
+			const counter_t previous{ m_counter.fetch_sub(decrement, std::memory_order_release) };
+			if (to_counts(previous) == decrement)
+			{
+				acquire_counter();
+				get_operations().m_deallocate(this);
+			}
+		}
+		/**	Increment counter by shared_one without an atomic read-modify-write.
+		 *	@detail Used by local_shared_ptr, whose control blocks are only ever counted by a single thread.
+		 */
+		void local_shared_inc() noexcept
+		{
+#if SH_POINTER_DEBUG_SHARED_PTR
+			validate_local_thread();
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+			m_counter.store(m_counter.load(std::memory_order_relaxed) + shared_one, std::memory_order_relaxed);
+		}
+		/**	Decrement counter by shared_one without an atomic read-modify-write. Calls destruct & deallocate if this was the last reference. Calls destruct if the last shared_one reference.
+		 *	@detail Used by local_shared_ptr, whose control blocks are only ever counted by a single thread.
+		 */
+		void local_shared_dec() noexcept
+		{
+#if SH_POINTER_DEBUG_SHARED_PTR
+			validate_local_thread();
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+			const counter_t previous{ m_counter.load(std::memory_order_relaxed) };
+			if (to_counts(previous) == shared_one)
+			{
+				// No other references remain to observe the count, so skip storing it.
+				release_last();
+				return;
+			}
+			m_counter.store(previous - shared_one, std::memory_order_relaxed);
+			if (to_value_count(previous) == 1u)
+			{
+				release_value();
+			}
+		}
+		/**	Try to increment counter by shared_one without an atomic read-modify-write. Will only succeed if counter contains at least one increment of value_one.
+		 *	@detail Used by local_weak_ptr::lock.
+		 *	@return If a the counter was incremented by shared_one, added_shared_inc. If no increment was performed, no_inc.
+		 */
+		shared_inc_if_nonzero_result local_shared_inc_if_nonzero() noexcept
+		{
+#if SH_POINTER_DEBUG_SHARED_PTR
+			validate_local_thread();
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+			const counter_t counter{ m_counter.load(std::memory_order_relaxed) };
+			if (to_value_count(counter) == 0)
+			{
+				return shared_inc_if_nonzero_result::no_inc;
+			}
+			m_counter.store(counter + shared_one, std::memory_order_relaxed);
+			return shared_inc_if_nonzero_result::added_shared_inc;
+		}
+		/**	Increment counter by weak_one without an atomic read-modify-write.
+		 *	@detail Used by local_weak_ptr.
+		 */
+		void local_weak_inc() noexcept
+		{
+#if SH_POINTER_DEBUG_SHARED_PTR
+			validate_local_thread();
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+			m_counter.store(m_counter.load(std::memory_order_relaxed) + weak_one, std::memory_order_relaxed);
+		}
+		/**	Decrement counter by weak_one without an atomic read-modify-write & call deallocate if this was the last reference.
+		 *	@detail Used by local_weak_ptr.
+		 */
+		void local_weak_dec() noexcept
+		{
+#if SH_POINTER_DEBUG_SHARED_PTR
+			validate_local_thread();
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+			const counter_t previous{ m_counter.load(std::memory_order_relaxed) };
+			if (to_counts(previous) == weak_one)
+			{
+				get_operations().m_deallocate(this);
+				return;
+			}
+			m_counter.store(previous - weak_one, std::memory_order_relaxed);
+		}
+		const control_operations& get_operations() const noexcept
+		{
+#if SH_POINTER_COMPACT_CONTROL
+			return control_operations_table::at(std::size_t((m_counter.load(std::memory_order_relaxed) & fixed_bits) >> index_shift));
+#else // !SH_POINTER_COMPACT_CONTROL
+			return *m_operations;
+#endif // !SH_POINTER_COMPACT_CONTROL
+		}
+
+	private:
+#if SH_POINTER_BIASED_COUNT
+		friend class bias_owner;
+
+		/**	Return the control_bias of this control block or nullptr if not biased.
+		 */
+		control_bias* get_bias() const noexcept
+		{
+			const std::size_t offset{ get_operations().m_bias_offset };
+			return offset != 0
+				? reinterpret_cast<control_bias*>(reinterpret_cast<std::uintptr_t>(this) + offset)
+				: nullptr;
+		}
+		/**	Return true if the calling thread counts in bias.m_biased.
+		 */
+		static bool bias_is_local(const control_bias& bias) noexcept
+		{
+			// Only the owning thread sets merged_bit while it lives.
+			return bias.m_owner == bias_owner::current_if_any()
+				&& (bias.m_shared.load(std::memory_order_relaxed) & control_bias::merged_bit) == 0;
+		}
+		/**	Return the number of shared references counted by a bias, excluding any held by its queue entry.
+		 *	@param bias The bias.
+		 *	@param shared A value of bias.m_shared.
+		 */
+		static control_bias::shared_t bias_count(const control_bias& bias, const control_bias::shared_t shared) noexcept
+		{
+			control_bias::shared_t count{ control_bias::to_shared_count(shared) };
+			if ((shared & control_bias::merged_bit) == 0)
+			{
+				count += bias.m_biased.load(std::memory_order_relaxed);
+			}
+			if (shared & control_bias::queued_bit)
+			{
+				--count;
+			}
+			return count;
+		}
+		/**	Return the number of shared references counted by a bias.
+		 */
+		static use_count_t bias_get_count(const control_bias& bias) noexcept
+		{
+			const control_bias::shared_t count{ bias_count(bias, bias.m_shared.load(std::memory_order_relaxed)) };
+			return count > 0 ? use_count_t(count) : use_count_t{ 0 };
+		}
+		/**	Increment a bias by \p count shared references.
+		 */
+		static void bias_inc(control_bias& bias, const use_count_t count) noexcept
+		{
+			if (bias_is_local(bias))
+			{
+				bias.m_biased.store(bias.m_biased.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+			}
+			else
+			{
+				bias.m_shared.fetch_add(control_bias::shared_one * count, std::memory_order_relaxed);
+			}
+		}
+		/**	Try to increment a bias by a shared reference, succeeding only if it counts at least one.
+		 */
+		static shared_inc_if_nonzero_result bias_inc_if_nonzero(control_bias& bias) noexcept
+		{
+			if (bias_is_local(bias))
+			{
+				if (bias_get_count(bias) == 0)
+				{
+					return shared_inc_if_nonzero_result::no_inc;
+				}
+				bias.m_biased.store(bias.m_biased.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				return shared_inc_if_nonzero_result::added_shared_inc;
+			}
+			control_bias::shared_t shared{ bias.m_shared.load(std::memory_order_relaxed) };
+			for (;;)
+			{
+				if (bias_count(bias, shared) <= 0)
+				{
+					return shared_inc_if_nonzero_result::no_inc;
+				}
+				if (bias.m_shared.compare_exchange_weak(shared, shared + control_bias::shared_one))
+				{
+					return shared_inc_if_nonzero_result::added_shared_inc;
+				}
+			}
+		}
+		/**	Decrement a bias by \p count shared references, releasing the bias's reference to this control block if
+		 *	these were the last.
+		 */
+		void bias_dec(control_bias& bias, const use_count_t count) noexcept
+		{
+			using shared_t = control_bias::shared_t;
+			bias_owner* const local{ bias_owner::current_if_any() };
+			if (bias.m_owner == local
+				&& (bias.m_shared.load(std::memory_order_relaxed) & control_bias::merged_bit) == 0)
+			{
+				const use_count_t biased{ bias.m_biased.load(std::memory_order_relaxed) };
+				if (biased > count)
+				{
+					bias.m_biased.store(biased - count, std::memory_order_relaxed);
+				}
+				else
+				{
+					// Releasing the last biased reference, so merge:
+					const shared_t delta{ (shared_t(biased) - shared_t(count)) * control_bias::shared_one };
+					const shared_t previous{ bias.m_shared.fetch_add(delta + control_bias::merged_bit, std::memory_order_acq_rel) };
+					if (control_bias::to_shared_count(previous + delta) == 0)
+					{
+						// Release the bias's reference:
+						counter_shared_dec();
+					}
+				}
+				if (local->has_queued())
+				{
+					local->merge_queued();
+				}
+				return;
+			}
+
+			shared_t shared{ bias.m_shared.load(std::memory_order_relaxed) };
+			for (;;)
+			{
+				if (shared & control_bias::merged_bit)
+				{
+					const shared_t previous{ bias.m_shared.fetch_sub(control_bias::shared_one * count, std::memory_order_acq_rel) };
+					if (control_bias::to_shared_count(previous) == shared_t(count))
+					{
+						// Release the bias's reference:
+						counter_shared_dec();
+					}
+					return;
+				}
+				// Releasing references the owner counted requires the owner's
+				// attention, so queue to it. The queue holds one reference to
+				// keep this alive until merged:
+				const bool enqueue{ control_bias::to_shared_count(shared) < shared_t(count) && (shared & control_bias::queued_bit) == 0 };
+				const shared_t desired{ enqueue
+					? (shared - control_bias::shared_one * (count - 1)) | control_bias::queued_bit
+					: shared - control_bias::shared_one * count };
+				if (bias.m_shared.compare_exchange_weak(shared, desired, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					if (enqueue && bias.m_owner->push(bias) == false)
+					{
+						// The owner has exited, so merge here:
+						bias_merge(bias);
+					}
+					return;
+				}
+			}
+		}
+		/**	Merge a queued bias's m_biased into m_shared if not already merged, then release the queue's reference &
+		 *	clear queued_bit.
+		 *	@note Called by the owning thread or by any thread after the owning thread has exited.
 		 */
-		control(const counter_t counter, const control_operations& operations) noexcept
-			: m_counter{ counter }
-			, m_operations{ &operations }
-		{ }
-		control() = delete;
-		control(const control&) = delete;
-		control& operator=(const control&) = delete;
+		void bias_merge(control_bias& bias) noexcept
+		{
+			using shared_t = control_bias::shared_t;
+			const shared_t biased{ shared_t(bias.m_biased.load(std::memory_order_relaxed)) };
+			shared_t shared{ bias.m_shared.load(std::memory_order_relaxed) };
+			shared_t desired;
+			do
+			{
+				desired = (shared & control_bias::merged_bit)
+					? shared - control_bias::shared_one
+					: (shared + (biased - 1) * control_bias::shared_one) | control_bias::merged_bit;
+				desired &= ~control_bias::queued_bit;
+			} while (bias.m_shared.compare_exchange_weak(shared, desired, std::memory_order_acq_rel, std::memory_order_relaxed) == false);
+			if (control_bias::to_shared_count(desired) == 0)
+			{
+				// Release the bias's reference:
+				counter_shared_dec();
+			}
+		}
+#endif // SH_POINTER_BIASED_COUNT
 
-		/**	Return the number of value_one references in a given counter value.
-		 *	@param counter The counter from which to extract a shared_one reference count.
-		 *	@return The number of value_one references in the given counter.
+#if SH_POINTER_SPECIAL_COUNT
+		/**	Return the control_shards preceding this sharded control block.
 		 */
-		static constexpr std::uint32_t to_value_count(const counter_t counter) noexcept
+		control_shards& get_shards() const noexcept
 		{
-			// Truncate to remove control bits and retain value bits.
-			return std::uint32_t(counter);
+			return *reinterpret_cast<control_shards*>(reinterpret_cast<std::uintptr_t>(this) - sizeof(control_shards));
 		}
-		/**	Return the number of shared_one references.
-		 *	@detail Used by shared_ptr::use_count, weak_ptr::use_count, and weak_ptr::expired.
-		 *	@note Stored count may change immediately after returning
-		 *	@return The number of shared_one references.
+		/**	Increment the calling thread's shard by \p count shared references or, if collapsed, counter.
+		 *	@param count The number of shared_one references to add.
 		 */
-		use_count_t get_shared_count() const noexcept
+		void shard_inc(const use_count_t count) noexcept
 		{
-			// Each value count can only be from a shared count.
-			return use_count_t{ to_value_count(m_counter.load(std::memory_order_relaxed)) };
+			control_shards::shard& shard = get_shards().m_shards[control_shards::local_index()];
+			if (shard.m_count.fetch_add(count, std::memory_order_relaxed) & control_shards::collapsed_bit)
+			{
+				m_counter.fetch_add(shared_one * count, std::memory_order_relaxed);
+			}
 		}
-		/**	Increment counter by shared_one.
-		 *	@detail Used by shared_ptr.
+		/**	Try to increment the calling thread's shard by a shared reference or, if collapsed, counter.
+		 *	@return If a shared reference was added, added_shared_inc. Otherwise, no_inc.
 		 */
-		void shared_inc() noexcept
+		shared_inc_if_nonzero_result shard_inc_if_nonzero() noexcept
 		{
-			m_counter.fetch_add(shared_one, std::memory_order_relaxed);
+			control_shards::shard& shard = get_shards().m_shards[control_shards::local_index()];
+			if ((shard.m_count.fetch_add(1, std::memory_order_relaxed) & control_shards::collapsed_bit) == 0)
+			{
+				// Until this shard is collapsed, the collapsing thread's reference keeps the value alive.
+				return shared_inc_if_nonzero_result::added_shared_inc;
+			}
+			return counter_shared_inc_if_nonzero();
 		}
-		/**	Decrement counter by shared_one. Calls destruct & deallocate if this was the last reference. Calls destruct if the last shared_one reference.
-		 *	@detail Used by shared_ptr.
+		/**	Decrement shards by \p count shared references, taking first from the calling thread's shard & then from
+		 *	others. If the shards appear empty, decrement counter instead, collapsing if that would leave it with no
+		 *	shared references, which are then counted exactly.
+		 *	@param count The number of shared_one references to remove.
 		 */
-		void shared_dec() noexcept
+		void shard_dec(use_count_t count) noexcept
 		{
-			const counter_t previous{ m_counter.fetch_sub(shared_one, std::memory_order_release) };
-			if (previous == shared_one)
+			using shard_count_t = control_shards::shard_count_t;
+			control_shards& shards = get_shards();
+			const std::size_t local_index{ control_shards::local_index() };
+			for (std::size_t offset = 0; offset < control_shards::shard_count; ++offset)
 			{
-				// Acquire if last reference control + value reference.
-				std::atomic_thread_fence(std::memory_order_acquire);
-
-#if defined(__has_feature)
-#if __has_feature(thread_sanitizer)
-				// TSan doesn't know what to do with atomic_thread_fence, so
-				// hold its hand a bit to let it know m_counter has been
-				// acquired:
-				__tsan_acquire(&m_counter);
-#endif // __has_feature
-#endif // __has_feature(thread_sanitizer)
-
-				// If this was the last control reference.
-				get_operations().m_destruct(this);
-				get_operations().m_deallocate(this);
+				std::atomic<shard_count_t>& shard = shards.m_shards[(local_index + offset) % control_shards::shard_count].m_count;
+				shard_count_t value{ shard.load(std::memory_order_relaxed) };
+				while (value != 0)
+				{
+					if (value & control_shards::collapsed_bit)
+					{
+						counter_shared_dec(count);
+						return;
+					}
+					const shard_count_t taken{ std::min<shard_count_t>(value, count) };
+					if (shard.compare_exchange_weak(value, value - taken, std::memory_order_release, std::memory_order_relaxed))
+					{
+						count -= use_count_t(taken);
+						if (count == 0)
+						{
+							return;
+						}
+						break;
+					}
+				}
 			}
-			else if (to_value_count(previous) == 1u)
-			{
-				// Acquire if last reference value reference.
-				std::atomic_thread_fence(std::memory_order_acquire);
-
-#if defined(__has_feature)
-#if __has_feature(thread_sanitizer)
-				// TSan doesn't know what to do with atomic_thread_fence, so
-				// hold its hand a bit to let it know m_counter has been
-				// acquired:
-				__tsan_acquire(&m_counter);
-#endif // __has_feature
-#endif // __has_feature(thread_sanitizer)
 
-				// If this was only the last value reference.
-				get_operations().m_destruct(this);
+			// While sharded, counter keeps at least one shared reference, so that no shard count can be the last:
+			counter_t counter{ m_counter.load(std::memory_order_relaxed) };
+			while (counter & sharded_bit)
+			{
+				if (to_value_count(counter) <= count)
+				{
+					shard_collapse();
+					break;
+				}
+				if (m_counter.compare_exchange_weak(counter, counter - shared_one * count, std::memory_order_release, std::memory_order_relaxed))
+				{
+					return;
+				}
 			}
+			counter_shared_dec(count);
 		}
-
-		/**	Enumeration of return values from shared_inc_if_nonzero.
+		/**	Fold each shard's count into counter & mark it collapsed, then clear sharded_bit.
+		 *	@note Concurrent collapses each fold the shards they mark first.
 		 */
-		enum class shared_inc_if_nonzero_result : std::int8_t
+		void shard_collapse() noexcept
 		{
-			/**	No change was made to control.
-			 */
-			no_inc,
-			/**	An increment of shared_one was added to control and the associated value is valid.
-			 */
-			added_shared_inc
-		};
-
-		/**	Try to increment counter by shared_one. Will only succeed if counter contains at least one increment of value_one.
-		 *	@detail Used by weak_ptr::lock.
+			using shard_count_t = control_shards::shard_count_t;
+			// Hold a guard reference while folding, so that a concurrent collapse can't release the last reference
+			// before the counts this one folds are added:
+			m_counter.fetch_add(shared_one, std::memory_order_relaxed);
+			for (control_shards::shard& shard : get_shards().m_shards)
+			{
+				const shard_count_t previous{ shard.m_count.fetch_or(control_shards::collapsed_bit, std::memory_order_acq_rel) };
+				if ((previous & control_shards::collapsed_bit) == 0 && previous != 0)
+				{
+					m_counter.fetch_add(shared_one * previous, std::memory_order_relaxed);
+				}
+			}
+			m_counter.fetch_and(~sharded_bit, std::memory_order_relaxed);
+			counter_shared_dec();
+		}
+#endif // SH_POINTER_SPECIAL_COUNT
+		/**	Try to increment counter by shared_one, succeeding only if it counts at least one value_one.
 		 *	@return If a the counter was incremented by shared_one, added_shared_inc. If no increment was performed, no_inc.
 		 */
-		shared_inc_if_nonzero_result shared_inc_if_nonzero() noexcept
+		shared_inc_if_nonzero_result counter_shared_inc_if_nonzero() noexcept
 		{
 			counter_t counter{ m_counter.load() };
 			// Can't increment value if it's zero, it's already been destructed.
@@ -293,71 +1867,160 @@ namespace sh::pointer
 			}
 			return shared_inc_if_nonzero_result::no_inc;
 		}
-		/**	Decrement counter by value_one & call destruct if this was the last value reference.
-		 *	@detail Used by wide_weak_ptr when it must lock to cast to demote the wide_shared_ptr's reference from shared_one to control_one.
+		/**	Decrement counter by \p count shared_one references. Calls destruct & deallocate if these were the last references. Calls destruct if these were the last shared_one references.
+		 *	@param count The number of shared_one references to remove.
 		 */
-		void value_dec_for_shared_to_weak() noexcept
+		void counter_shared_dec(const use_count_t count = 1) noexcept
 		{
-			const counter_t previous{ m_counter.fetch_sub(value_one, std::memory_order_release) };
-			if (to_value_count(previous) == 1u)
+			const counter_t decrement{ shared_one * count };
+			const counter_t previous{ m_counter.fetch_sub(decrement, std::memory_order_release) };
+			if (to_counts(previous) == decrement)
 			{
-				// Acquire if last value reference.
-				std::atomic_thread_fence(std::memory_order_acquire);
+				// Acquire if last reference control + value reference.
+				acquire_counter();
+
+				// If this was the last control reference.
+				release_last();
+			}
+			else if (to_value_count(previous) == count)
+			{
+				// Acquire if last reference value reference.
+				acquire_counter();
 
 				// If this was only the last value reference.
-				get_operations().m_destruct(this);
+				release_value();
 			}
 		}
-		/**	Increment counter by weak_one.
-		 *	@detail Used by weak_ptr.
+
+		/**	Destruct the associated value(s) & deallocate this, the last reference to which has been released.
+		 *	@detail If SH_POINTER_ITERATIVE_DESTRUCT & called during another release on the same thread, this is queued
+		 *		to the outermost release, which releases queued control blocks in a loop. As no references remain,
+		 *		m_counter holds the link to the next queued control block.
 		 */
-		void weak_inc() noexcept
+		void release_last() noexcept
 		{
-			m_counter.fetch_add(weak_one, std::memory_order_relaxed);
+#if SH_POINTER_ITERATIVE_DESTRUCT
+			release_queue& queue = get_release_queue();
+			if (queue.m_draining)
+			{
+				m_counter.store(to_link(queue.m_head), std::memory_order_relaxed);
+				queue.m_head = this;
+				return;
+			}
+			queue.m_draining = true;
+			get_operations().m_destruct_deallocate(this);
+			queue.drain();
+#else // !SH_POINTER_ITERATIVE_DESTRUCT
+			get_operations().m_destruct_deallocate(this);
+#endif // !SH_POINTER_ITERATIVE_DESTRUCT
 		}
-		/**	Decrement counter by weak_one & call deallocate if this was the last reference.
-		 *	@detail Used by weak_ptr.
+		/**	Destruct the associated value(s), the last shared_one reference to which has been released.
+		 *	@detail If SH_POINTER_ITERATIVE_DESTRUCT, releases of other control blocks during destruction are queued &
+		 *		released in a loop afterward. As weak references remain, this can't be queued itself & so destructs
+		 *		immediately even if called during another release.
 		 */
-		void weak_dec() noexcept
+		void release_value() noexcept
 		{
-			// Before bothering with a store, check if we're the last
-			// reference. If so, no other weak or shared pointers could
-			// possibly be referencing this:
-			if (m_counter.load(std::memory_order_acquire) == weak_one)
+#if SH_POINTER_ITERATIVE_DESTRUCT
+			release_queue& queue = get_release_queue();
+			if (queue.m_draining)
 			{
-				// If this was the last control reference. Value destruction
-				// has already occurred, but deallocation is required.
-				get_operations().m_deallocate(this);
+				get_operations().m_destruct(this);
+				return;
 			}
-			else
+			queue.m_draining = true;
+			get_operations().m_destruct(this);
+			queue.drain();
+#else // !SH_POINTER_ITERATIVE_DESTRUCT
+			get_operations().m_destruct(this);
+#endif // !SH_POINTER_ITERATIVE_DESTRUCT
+		}
+
+#if SH_POINTER_ITERATIVE_DESTRUCT
+		/**	Control blocks whose last references were released during the release of another on the calling thread.
+		 */
+		struct release_queue final
+		{
+			/**	Release queued control blocks, including those queued while doing so, then clear m_draining.
+			 */
+			void drain() noexcept
 			{
-				// No luck, do the decrement:
-				const counter_t previous{ m_counter.fetch_sub(weak_one, std::memory_order_release) };
-				if (previous == weak_one)
+				while (control* const ctrl = m_head)
 				{
-					// Acquire if last control reference.
-					std::atomic_thread_fence(std::memory_order_acquire);
-
-					// If this was the last control reference. Value
-					// destruction has already occurred, but deallocation is
-					// required.
-					get_operations().m_deallocate(this);
+					m_head = ctrl->from_link();
+					ctrl->get_operations().m_destruct_deallocate(ctrl);
 				}
+				m_draining = false;
 			}
+
+			/**	The most recently queued control block, linked to those queued before it via m_counter.
+			 */
+			control* m_head{ nullptr };
+			/**	True while an outermost release is in progress on this thread.
+			 */
+			bool m_draining{ false };
+		};
+		/**	Return the value of m_counter linking this to the next queued control block.
+		 *	@param next The next queued control block or nullptr.
+		 *	@return The counter value, retaining fixed_bits.
+		 */
+		counter_t to_link(control* const next) const noexcept
+		{
+#if SH_POINTER_COMPACT_CONTROL
+			// Control blocks are aligned to 8 bytes, so shift out the zeroed low bits to fit beside fixed_bits:
+			const counter_t link{ counter_t(reinterpret_cast<std::uintptr_t>(next)) >> 3 };
+			SH_POINTER_ASSERT(to_counts(link) == link,
+				"Control block address too large to queue in a compact counter.");
+			return (m_counter.load(std::memory_order_relaxed) & fixed_bits) | link;
+#else // !SH_POINTER_COMPACT_CONTROL
+			return counter_t(reinterpret_cast<std::uintptr_t>(next));
+#endif // !SH_POINTER_COMPACT_CONTROL
+		}
+		/**	Return the next queued control block from m_counter as stored by to_link.
+		 */
+		control* from_link() const noexcept
+		{
+#if SH_POINTER_COMPACT_CONTROL
+			return reinterpret_cast<control*>(std::uintptr_t(to_counts(m_counter.load(std::memory_order_relaxed)) << 3));
+#else // !SH_POINTER_COMPACT_CONTROL
+			return reinterpret_cast<control*>(std::uintptr_t(m_counter.load(std::memory_order_relaxed)));
+#endif // !SH_POINTER_COMPACT_CONTROL
 		}
-		const control_operations& get_operations() noexcept
+		/**	Return the calling thread's release_queue.
+		 *	@return The queue, which is trivially destructible & so safe to use throughout thread exit.
+		 */
+		static release_queue& get_release_queue() noexcept
 		{
-			return *m_operations;
+			thread_local release_queue instance;
+			return instance;
+		}
+#endif // SH_POINTER_ITERATIVE_DESTRUCT
+
+		/**	Acquire m_counter after a release decrement found the last reference.
+		 */
+		void acquire_counter() noexcept
+		{
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+#if defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+			// TSan doesn't know what to do with atomic_thread_fence, so
+			// hold its hand a bit to let it know m_counter has been
+			// acquired:
+			__tsan_acquire(&m_counter);
+#endif // __has_feature
+#endif // __has_feature(thread_sanitizer)
 		}
 
-	private:
 		/**	The atomic counter value.
 		 */
 		std::atomic<counter_t> m_counter;
 
+#if !SH_POINTER_COMPACT_CONTROL
 		/**	Pointer to static table of operations accessible from control.
 		 */
 		const control_operations* const m_operations;
+#endif // !SH_POINTER_COMPACT_CONTROL
 
 #if SH_POINTER_DEBUG_SHARED_PTR
 	public:
@@ -366,56 +2029,129 @@ namespace sh::pointer
 		 */
 		void validate(const char* const origin) const noexcept
 		{
-			SH_POINTER_ASSERT(m_origin == origin,
-				"Pointer control block origin isn't as expected.");
+			control_validation::visit(this, [origin](const control_state& state) noexcept -> void
+			{
+				SH_POINTER_ASSERT(state.m_origin == origin,
+					"Pointer control block origin isn't as expected.");
+			});
 		}
 		/**	In debug validation, check the a control will properly destruct a value.
 		 *	@param origin The origin to check against the origin set in validate_set_origin.
 		 */
 		void validate_destruct(const char* const origin) noexcept
 		{
-			validate(origin);
-			SH_POINTER_ASSERT(m_destructed == false,
-				"Control block destructing has already been destructed.");
-			SH_POINTER_ASSERT(m_deallocated == false,
-				"Control block destructing has already been deallocated.");
-			m_destructed = true;
+			control_validation::visit(this, [origin](control_state& state) noexcept -> void
+			{
+				SH_POINTER_ASSERT(state.m_origin == origin,
+					"Pointer control block origin isn't as expected.");
+				SH_POINTER_ASSERT(state.m_destructed == false,
+					"Control block destructing has already been destructed.");
+				state.m_destructed = true;
+			});
 		}
 		/**	In debug validation, check the a control will properly deallocate (either storage or value).
 		 *	@param origin The origin to check against the origin set in validate_set_origin.
 		 */
 		void validate_deallocate(const char* const origin) noexcept
 		{
-			validate(origin);
-			SH_POINTER_ASSERT(m_destructed == true,
-				"Control block deallocating hasn't been destructed yet.");
-			SH_POINTER_ASSERT(m_deallocated == false,
-				"Control block deallocating has already been deallocated");
-			m_deallocated = true;
+			control_validation::visit(this, [origin](const control_state& state) noexcept -> void
+			{
+				SH_POINTER_ASSERT(state.m_origin == origin,
+					"Pointer control block origin isn't as expected.");
+				SH_POINTER_ASSERT(state.m_destructed == true,
+					"Control block deallocating hasn't been destructed yet.");
+			});
+			control_validation::erase(this);
 		}
 		/**	In debug validation, assign an origin to be checked by other validate functions.
 		 *	@param origin The origin to later check against.
+		 *	@param element_count The number of elements controlled, to be checked by validate_index.
 		 */
-		void validate_set_origin(const char* const origin) noexcept
+		void validate_set_origin(const char* const origin,
+			const std::size_t element_count = std::numeric_limits<std::size_t>::max()) noexcept
 		{
-			SH_POINTER_ASSERT(m_origin == nullptr,
-				"Changing control block origin a second time.");
-			m_origin = origin;
+			control_validation::insert(this, origin, element_count);
 		}
-
-	private:
-		/**	For debug validation, a pointer to a static string identifying where this control originated.
+		/**	In debug validation, check that an index is within the elements controlled.
+		 *	@param index The index.
 		 */
-		const char* m_origin = nullptr;
-		/**	For debug validation, a flag to show if the associated data has been destructed.
+		void validate_index(const std::size_t index) const noexcept
+		{
+			control_validation::visit(this, [index](const control_state& state) noexcept -> void
+			{
+				SH_POINTER_ASSERT(index < state.m_element_count,
+					"Index given to operator[] is out of bounds.");
+			});
+		}
+		/**	In debug validation, assign the calling thread as the only one allowed to count references locally.
 		 */
-		bool m_destructed{ false };
-		/**	For debug validation, a flag to show if the associated data has been deallocated.
+		void validate_set_local_thread() noexcept
+		{
+			control_validation::visit(this, [](control_state& state) noexcept -> void
+			{
+				state.m_local_thread = std::this_thread::get_id();
+			});
+		}
+		/**	In debug validation, check that references are counted locally by the thread set in validate_set_local_thread.
 		 */
-		bool m_deallocated{ false };
+		void validate_local_thread() const noexcept
+		{
+			control_validation::visit(this, [](const control_state& state) noexcept -> void
+			{
+				SH_POINTER_ASSERT(state.m_local_thread == std::this_thread::get_id(),
+					"Locally counted control block used by a thread other than its owner.");
+			});
+		}
 #endif // SH_POINTER_DEBUG_SHARED_PTR
+
+#if SH_POINTER_PROFILE
+	private:
+		/**	For profiling, record the calling thread's current reference count operation if sampled.
+		 */
+		void profile() const noexcept
+		{
+			if (control_profile::sampled())
+			{
+				control_profile::record(this, get_operations().m_get_origin());
+			}
+		}
+#endif // SH_POINTER_PROFILE
 	};
 
+#if SH_POINTER_BIASED_COUNT
+	inline bias_owner::thread_owner::~thread_owner()
+	{
+		if (bias_owner* const owner = std::exchange(m_owner, nullptr))
+		{
+			owner->merge_queued(closed);
+			owner->release();
+		}
+	}
+	inline bool bias_owner::push(control_bias& bias) noexcept
+	{
+		std::uintptr_t head{ m_queue.load(std::memory_order_acquire) };
+		do
+		{
+			if (head == closed)
+			{
+				return false;
+			}
+			bias.m_next_queued = reinterpret_cast<control_bias*>(head);
+		} while (m_queue.compare_exchange_weak(head, reinterpret_cast<std::uintptr_t>(&bias), std::memory_order_release, std::memory_order_acquire) == false);
+		return true;
+	}
+	inline void bias_owner::merge_queued(const std::uintptr_t replacement) noexcept
+	{
+		control_bias* next{ reinterpret_cast<control_bias*>(m_queue.exchange(replacement, std::memory_order_acq_rel)) };
+		while (next)
+		{
+			// Merging may release the last reference, so advance first:
+			control_bias& bias = *std::exchange(next, next->m_next_queued);
+			bias.m_ctrl->bias_merge(bias);
+		}
+	}
+#endif // SH_POINTER_BIASED_COUNT
+
 	/**	An aligned control block. Intended to be convert to & from value(s) with convert_control_to_value and convert_value_to_control.
 	 *	@note Used by sh::shared_ptr (via convert_value_to_control) and sh::weak_ptr.
 	 */
@@ -588,10 +2324,17 @@ namespace sh::pointer
 
 	template <
 		typename T,
-		typename Alloc
+		typename Alloc,
+		bool Biased = false
 	>
 		requires (false == std::is_array_v<T>)
 	class value_convertible_to_control;
+	template <
+		typename T,
+		typename Alloc
+	>
+		requires (false == std::is_array_v<T>)
+	class slab_of_values_convertible_to_control;
 
 	/**	Storage & base class for enable_shared_from_this.
 	 */
@@ -618,9 +2361,12 @@ namespace sh::pointer
 
 	private:
 		template <typename T> friend class ::sh::enable_shared_from_this;
-		template <typename T, typename Alloc>
+		template <typename T, typename Alloc, bool Biased>
 			requires (false == std::is_array_v<T>)
 		friend class value_convertible_to_control;
+		template <typename T, typename Alloc>
+			requires (false == std::is_array_v<T>)
+		friend class slab_of_values_convertible_to_control;
 
 		/**	Control block associated with a type that inherits from control_from_this, presumably via enable_shared_from_this.
 		 *	@note Is filled with non-nullptr value during value_convertible_to_control::allocate, which is called during make_shared. Direct construction (aliasing and similar) and many allocators (arrays of elements) will not initialize this value.
@@ -631,10 +2377,13 @@ namespace sh::pointer
 	/**	Allocate a control block associated with a value of type T using a given allocator.
 	 *	@tparam T The value type.
 	 *	@tparam Alloc The allocator type.
+	 *	@tparam Biased If true, the control block counts references biased toward the allocating thread. Requires SH_POINTER_BIASED_COUNT.
+	 *	@note If T has extended alignment, its control block is offset within a padded allocation rather than raising max_alignment.
 	 */
 	template <
 		typename T,
-		typename Alloc
+		typename Alloc,
+		bool Biased
 	>
 		requires (false == std::is_array_v<T>)
 	class value_convertible_to_control final
@@ -645,23 +2394,66 @@ namespace sh::pointer
 		using value_allocator_traits = typename allocator_traits::template rebind_traits<element_type>;
 		using value_allocator = typename value_allocator_traits::allocator_type;
 
+#if SH_POINTER_BIASED_COUNT
+		/**	Stand-in for control_bias if not Biased.
+		 */
+		struct no_bias final
+		{
+			constexpr no_bias(control&, bias_owner*) noexcept
+			{ }
+		};
+		using bias_type = std::conditional_t<Biased, control_bias, no_bias>;
+#else // !SH_POINTER_BIASED_COUNT
+		static_assert(Biased == false, "Biased control blocks require SH_POINTER_BIASED_COUNT.");
+#endif // !SH_POINTER_BIASED_COUNT
+
+		template <typename U, typename OtherAlloc, bool OtherBiased>
+			requires (false == std::is_array_v<U>)
+		friend class value_convertible_to_control;
+
+		/**	If true, element_type's control operations are those of a trivial_value of the same size & alignment, as
+		 *	neither destroys a value & both deallocate an identically laid out storage_type. See SH_POINTER_SHARE_OPERATIONS.
+		 *	@note Limited to empty allocators, as the shared operations would otherwise read the stored value_allocator as
+		 *	a rebind to trivial_value.
+		 */
+		static constexpr bool shares_operations{ SH_POINTER_SHARE_OPERATIONS
+			&& is_destroy_trivial_v<value_allocator, element_type>
+			&& is_rebind_agnostic_v<Alloc>
+			&& std::is_empty_v<value_allocator> };
+		/**	The class whose operations (& debug origin) are used by control blocks of element_type.
+		 */
+		using operations_origin = std::conditional_t<shares_operations,
+			value_convertible_to_control<
+				trivial_value<sizeof(element_type), alignof(element_type)>,
+				typename allocator_traits::template rebind_alloc<std::byte>,
+				Biased>,
+			value_convertible_to_control>;
+
 		/**	A convertible control block with an allocator and storage space for an associate value.
 		 */
 		struct storage_type final
 		{
 			/**	Construct storage for an element_type.
 			 *	@param alloc The allocator to be used for constructing and destroying the value.
+			 *	@param owner If Biased, the bias_owner of the allocating thread. Otherwise, nullptr.
 			 */
-			explicit storage_type(value_allocator&& alloc) noexcept
-				: m_ctrl{ control::shared_one, value_convertible_to_control::operations() }
+			explicit storage_type(value_allocator&& alloc
+#if SH_POINTER_BIASED_COUNT
+				, bias_owner* const owner
+#endif // SH_POINTER_BIASED_COUNT
+			) noexcept
+				: m_ctrl{ control::shared_one, operations_origin::operations() }
 				, m_alloc{ alloc }
+#if SH_POINTER_BIASED_COUNT
+				, m_bias{ m_ctrl, owner }
+#endif // SH_POINTER_BIASED_COUNT
 			{
 				static_assert(std::is_nothrow_move_constructible_v<value_allocator>,
 					"Exceptions from value_allocator move contructor aren't expected.");
 				static_assert(std::is_nothrow_constructible_v<
 						convertible_control,
 						decltype(control::shared_one),
-						decltype(value_convertible_to_control::operations())>,
+						decltype(operations_origin::operations())>,
 					"Exceptions from convertible_control constructor aren't expected.");
 				static_assert(is_pointer_interconvertible_with_class(&std::remove_pointer_t<decltype(this)>::m_ctrl),
 					"reinterpret_cast from convertible_control to storage_type must be valid.");
@@ -682,13 +2474,57 @@ namespace sh::pointer
 			/**	Allocator used for constructing and destroying value.
 			 */
 			SH_POINTER_NO_UNIQUE_ADDRESS value_allocator m_alloc;
+
+#if SH_POINTER_BIASED_COUNT
+			/**	Biased reference counting state if Biased.
+			 */
+			SH_POINTER_NO_UNIQUE_ADDRESS bias_type m_bias;
+#endif // SH_POINTER_BIASED_COUNT
 		};
 
 		using storage_allocator_traits = typename allocator_traits::template rebind_traits<storage_type>;
 		using storage_allocator = typename storage_allocator_traits::allocator_type;
 
-#if SH_POINTER_DEBUG_SHARED_PTR
-		/**	For debug validation, return a pointer to a static string identifying this class.
+		/**	If element_type has extended alignment (beyond that of convertible_control), storage_type is allocated within
+		 *	aligned_bytes, offset by control_padding bytes so that m_value is aligned as element_type.
+		 */
+		static constexpr bool is_padded{ alignof(element_type) > alignof(convertible_control) };
+		/**	The number of bytes preceding storage_type in its allocation. Zero unless is_padded.
+		 */
+		static constexpr std::size_t control_padding{ is_padded
+			? (sizeof(convertible_control) + alignof(element_type) - 1u) / alignof(element_type) * alignof(element_type) - sizeof(convertible_control)
+			: 0u };
+
+		/**	Trivial data type sized to hold control_padding bytes followed by storage_type & aligned as element_type.
+		 *	@note Only allocated if is_padded.
+		 */
+		struct alignas(element_type) aligned_bytes final
+		{
+			std::byte m_bytes[control_padding + sizeof(storage_type)];
+		};
+		using allocation_type = std::conditional_t<is_padded, aligned_bytes, storage_type>;
+		using allocation_allocator_traits = typename allocator_traits::template rebind_traits<allocation_type>;
+		using allocation_allocator = typename allocation_allocator_traits::allocator_type;
+
+		/**	Return the storage_type within an allocation.
+		 *	@param allocation The allocation.
+		 *	@return The storage_type control_padding bytes into \p allocation.
+		 */
+		static storage_type* to_storage(allocation_type* const allocation) noexcept
+		{
+			return forward_offset_cast<storage_type*>(allocation, std::integral_constant<std::size_t, control_padding>{});
+		}
+		/**	Return the allocation containing a storage_type.
+		 *	@param storage The storage_type.
+		 *	@return The allocation control_padding bytes before \p storage.
+		 */
+		static allocation_type* to_allocation(storage_type* const storage) noexcept
+		{
+			return backward_offset_cast<allocation_type*>(storage, std::integral_constant<std::size_t, control_padding>{});
+		}
+
+#if SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+		/**	For debug validation & profiling, return a pointer to a static string identifying this class.
 		 *	@return A pointer to a static string identifying this class.
 		 */
 		static const char* origin() noexcept
@@ -696,60 +2532,81 @@ namespace sh::pointer
 			static const char* const instance = typeid(value_convertible_to_control).name();
 			return instance;
 		}
-#endif // SH_POINTER_DEBUG_SHARED_PTR
+#endif // SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
 
 		/**	Return a reference to a static control_operations structure.
 		 *	@return A reference to a static control_operations structure.
 		 */
 		static const control_operations& operations() noexcept
 		{
+			static constexpr auto destruct = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_destruct(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+				storage_type& storage = reinterpret_cast<storage_type&>(static_cast<convertible_control&>(*ctrl));
+				element_type& value = convert_control_to_value<element_type&>(storage.m_ctrl);
+				value_allocator_traits::destroy(storage.m_alloc, std::addressof(value));
+			};
+			static constexpr auto deallocate = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_deallocate(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+				storage_type* const storage = reinterpret_cast<storage_type*>(static_cast<convertible_control*>(ctrl));
+
+				// Move this allocator out of storage before destroying & deleting it.
+				storage_allocator storage_alloc{ std::move(storage->m_alloc) };
+				storage_allocator_traits::destroy(storage_alloc, storage);
+
+				allocation_allocator allocation_alloc{ std::move(storage_alloc) };
+				allocation_allocator_traits::deallocate(allocation_alloc, to_allocation(storage), 1);
+			};
 			static const control_operations instance{
 #ifdef __cpp_designated_initializers
 				.m_destruct =
 #endif // __cpp_designated_initializers
-				/* destruct */
-				[](control* const ctrl) noexcept -> void
-				{
-#if SH_POINTER_DEBUG_SHARED_PTR
-					ctrl->validate_destruct(origin());
-#endif // SH_POINTER_DEBUG_SHARED_PTR
-
-					storage_type& storage = reinterpret_cast<storage_type&>(static_cast<convertible_control&>(*ctrl));
-					element_type& value = convert_control_to_value<element_type&>(storage.m_ctrl);
-					value_allocator_traits::destroy(storage.m_alloc, std::addressof(value));
-				},
+				/* destruct */ destruct,
 #ifdef __cpp_designated_initializers
 				.m_deallocate =
 #endif // __cpp_designated_initializers
-				/* deallocate */
+				/* deallocate */ deallocate,
+#ifdef __cpp_designated_initializers
+				.m_destruct_deallocate =
+#endif // __cpp_designated_initializers
+				/* destruct_deallocate */
 				[](control* const ctrl) noexcept -> void
 				{
+					if constexpr (is_destroy_trivial_v<value_allocator, element_type>)
+					{
 #if SH_POINTER_DEBUG_SHARED_PTR
-					ctrl->validate_deallocate(origin());
+						ctrl->validate_destruct(origin());
 #endif // SH_POINTER_DEBUG_SHARED_PTR
-
-					storage_type* const storage = reinterpret_cast<storage_type*>(static_cast<convertible_control*>(ctrl));
-
-					// Move this allocator out of storage before destroying & deleting it.
-					storage_allocator storage_alloc{ std::move(storage->m_alloc) };
-					storage_allocator_traits::destroy(storage_alloc, storage);
-					storage_allocator_traits::deallocate(storage_alloc, storage, 1);
+					}
+					else
+					{
+						destruct(ctrl);
+					}
+					deallocate(ctrl);
 				},
 #ifdef __cpp_designated_initializers
 				.m_get_deleter =
 #endif // __cpp_designated_initializers
 				/* get_deleter */ nullptr,
-#if SH_POINTER_DEBUG_SHARED_PTR
+#if SH_POINTER_PROFILE
 #ifdef __cpp_designated_initializers
-				.m_get_element_count =
+				.m_get_origin =
 #endif // __cpp_designated_initializers
-				/* get_element_count */
-				[](const control* const ctrl) noexcept -> std::size_t
-				{
-					ctrl->validate(origin());
-					return 1;
-				},
-#endif // SH_POINTER_DEBUG_SHARED_PTR
+				/* get_origin */ origin,
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_BIASED_COUNT
+#ifdef __cpp_designated_initializers
+				.m_bias_offset =
+#endif // __cpp_designated_initializers
+				/* bias_offset */ Biased ? offsetof(storage_type, m_bias) - offsetof(storage_type, m_ctrl) : 0,
+#endif // SH_POINTER_BIASED_COUNT
 			};
 			return instance;
 		}
@@ -766,11 +2623,31 @@ namespace sh::pointer
 		template <construct_method Construct, typename... Args>
 		static element_type* allocate(const Alloc& alloc, Args&&... args)
 		{
+			if constexpr (shares_operations)
+			{
+				using origin_storage_type = typename operations_origin::storage_type;
+				static_assert(sizeof(origin_storage_type) == sizeof(storage_type)
+					&& alignof(origin_storage_type) == alignof(storage_type)
+					&& offsetof(origin_storage_type, m_alloc) == offsetof(storage_type, m_alloc)
+					&& operations_origin::control_padding == control_padding,
+					"Shared control operations require an identically laid out storage_type.");
+			}
+
+			allocation_allocator allocation_alloc{ alloc };
 			storage_allocator storage_alloc{ alloc };
 
-			constexpr std::size_t storage_element_count{ 1 };
-			storage_type* const storage = storage_allocator_traits::allocate(storage_alloc, storage_element_count);
+#if SH_POINTER_BIASED_COUNT
+			bias_owner* const owner = Biased ? &bias_owner::current() : nullptr;
+#endif // SH_POINTER_BIASED_COUNT
+
+			constexpr std::size_t allocation_element_count{ 1 };
+			allocation_type* const allocation = allocation_allocator_traits::allocate(allocation_alloc, allocation_element_count);
+			storage_type* const storage = to_storage(allocation);
+#if SH_POINTER_BIASED_COUNT
+			storage_allocator_traits::construct(storage_alloc, storage, value_allocator{ alloc }, owner);
+#else // !SH_POINTER_BIASED_COUNT
 			storage_allocator_traits::construct(storage_alloc, storage, value_allocator{ alloc });
+#endif // !SH_POINTER_BIASED_COUNT
 
 			element_type* const value = reinterpret_cast<element_type*>(&storage->m_value);
 
@@ -804,7 +2681,7 @@ namespace sh::pointer
 				catch (...)
 				{
 					storage_allocator_traits::destroy(storage_alloc, storage);
-					storage_allocator_traits::deallocate(storage_alloc, storage, storage_element_count);
+					allocation_allocator_traits::deallocate(allocation_alloc, allocation, allocation_element_count);
 					throw;
 				}
 			}
@@ -817,7 +2694,7 @@ namespace sh::pointer
 				control_from_value->m_ctrl = &storage->m_ctrl;
 			}
 #if SH_POINTER_DEBUG_SHARED_PTR
-			storage->m_ctrl.validate_set_origin(origin());
+			storage->m_ctrl.validate_set_origin(operations_origin::origin());
 #endif // SH_POINTER_DEBUG_SHARED_PTR
 			return value;
 		}
@@ -887,11 +2764,15 @@ namespace sh::pointer
 		using storage_allocator_traits = typename allocator_traits::template rebind_traits<storage_type>;
 		using storage_allocator = typename storage_allocator_traits::allocator_type;
 
-		/**	Trivial data type sized & aligned as storage_type (aligned as max_alignment).
+		/**	Trivial data type sized & aligned as max_alignment, the unit in which storage_type & its elements are allocated.
+		 *	@note Allocating in units of max_alignment rather than sizeof(storage_type) avoids rounding the elements up to
+		 *	a multiple of the latter, which grows with stateful allocators (e.g., std::pmr::polymorphic_allocator).
 		 */
 		struct alignas(storage_type) aligned_bytes final
 		{
-			std::byte m_bytes[sizeof(storage_type)];
+			std::byte m_bytes[alignof(storage_type)];
+
+			static_assert(sizeof(storage_type) % alignof(storage_type) == 0);
 
 			/**	Return the number of aligned_byte elements required to hold storage_type + the given count of element_type elements.
 			 *	@param element_count The number of elements of element_type to allocate in the array.
@@ -900,7 +2781,7 @@ namespace sh::pointer
 			static constexpr auto element_count(const count_type& element_count) noexcept
 			{
 				return
-					/* storage_type[1]: */ 1u +
+					/* storage_type[1]: */ sizeof(storage_type) / sizeof(aligned_bytes) +
 					/* element_type[element_count]: */ (
 						((element_count() * sizeof(element_type)) // sizeof(element_type[element_count])
 							+ (sizeof(aligned_bytes) - 1u)) // 1 minus sizeof(aligned_bytes) to cause ceil during truncating division.
@@ -911,8 +2792,8 @@ namespace sh::pointer
 		using aligned_bytes_allocator_traits = typename allocator_traits::template rebind_traits<aligned_bytes>;
 		using aligned_bytes_allocator = typename aligned_bytes_allocator_traits::allocator_type;
 
-#if SH_POINTER_DEBUG_SHARED_PTR
-		/**	For debug validation, return a pointer to a static string identifying this class.
+#if SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+		/**	For debug validation & profiling, return a pointer to a static string identifying this class.
 		 *	@return A pointer to a static string identifying this class.
 		 */
 		static const char* origin() noexcept
@@ -920,174 +2801,489 @@ namespace sh::pointer
 			static const char* const instance = typeid(array_of_values_convertible_to_control).name();
 			return instance;
 		}
+#endif // SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+
+		/**	Return a reference to a static control_operations structure.
+		 *	@return A reference to a static control_operations structure.
+		 */
+		static const control_operations& operations() noexcept
+		{
+			static constexpr auto destruct = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_destruct(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+				storage_type* const storage = backward_offset_cast<storage_type*>(
+					static_cast<convertible_control*>(ctrl),
+					std::integral_constant<std::size_t, offsetof(storage_type, m_ctrl)>{});
+
+				element_type* const values = std::addressof(convert_control_to_value<element_type&>(storage->m_ctrl));
+
+				for (element_type* cur = values + storage->m_element_count(); cur != values; )
+				{
+					--cur;
+					value_allocator_traits::destroy(storage->m_alloc, cur);
+				}
+			};
+			static constexpr auto deallocate = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_deallocate(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+				storage_type* const storage = backward_offset_cast<storage_type*>(
+					static_cast<convertible_control*>(ctrl),
+					std::integral_constant<std::size_t, offsetof(storage_type, m_ctrl)>{});
+				aligned_bytes* const bytes = reinterpret_cast<aligned_bytes*>(storage);
+
+				// Move this allocator, element_count out of storage before destroying & deleting it.
+				storage_allocator storage_alloc{ std::move(storage->m_alloc) };
+				const count_type element_count{ std::move(storage->m_element_count) };
+				storage_allocator_traits::destroy(storage_alloc, storage);
+
+				aligned_bytes_allocator aligned_bytes_alloc{ std::move(storage_alloc) };
+				aligned_bytes_allocator_traits::deallocate(
+					aligned_bytes_alloc,
+					bytes,
+					aligned_bytes::element_count(element_count));
+			};
+			static const control_operations instance{
+#ifdef __cpp_designated_initializers
+				.m_destruct =
+#endif // __cpp_designated_initializers
+				/* destruct */ destruct,
+#ifdef __cpp_designated_initializers
+				.m_deallocate =
+#endif // __cpp_designated_initializers
+				/* deallocate */ deallocate,
+#ifdef __cpp_designated_initializers
+				.m_destruct_deallocate =
+#endif // __cpp_designated_initializers
+				/* destruct_deallocate */
+				[](control* const ctrl) noexcept -> void
+				{
+					if constexpr (is_destroy_trivial_v<value_allocator, element_type>)
+					{
+#if SH_POINTER_DEBUG_SHARED_PTR
+						ctrl->validate_destruct(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+					}
+					else
+					{
+						destruct(ctrl);
+					}
+					deallocate(ctrl);
+				},
+#ifdef __cpp_designated_initializers
+				.m_get_deleter =
+#endif // __cpp_designated_initializers
+				/* get_deleter */ nullptr,
+#if SH_POINTER_PROFILE
+#ifdef __cpp_designated_initializers
+				.m_get_origin =
+#endif // __cpp_designated_initializers
+				/* get_origin */ origin,
+#endif // SH_POINTER_PROFILE
+			};
+			return instance;
+		}
+
+	public:
+		/**	Allocate a control block associated with an array of values using a given allocator.
+		 *	@throw May throw std::bad_alloc or other exceptions during allocation & construction.
+		 *	@tparam Construct If no arguments are given and this is default_ctor, value may be default constructed. Otherwise uses value construction.
+		 *	@tparam Args The argument types to pass to value's constructor T::T.
+		 *	@param alloc The value allocator.
+		 *	@param element_count The number of elements of element_type to allocate in the array.
+		 *	@param args The arguments to pass to value's constructor (element_type::element_type).
+		 *	@return The pointer to the control value. Use convert_value_to_control to access the associated control block.
+		 */
+		template <construct_method Construct, typename... Args>
+		static element_type* allocate_array(const Alloc& alloc, const count_type& element_count, Args&&... args)
+		{
+			aligned_bytes_allocator aligned_bytes_alloc{ alloc };
+			const std::size_t aligned_byte_element_count = aligned_bytes::element_count(element_count);
+
+			aligned_bytes* const bytes = aligned_bytes_allocator_traits::allocate(aligned_bytes_alloc, aligned_byte_element_count);
+
+			storage_type* const storage = reinterpret_cast<storage_type*>(bytes);
+			storage_allocator storage_alloc{ alloc };
+			storage_allocator_traits::construct(storage_alloc, storage,
+				value_allocator{ alloc },
+				element_count
+			);
+
+			element_type* const values = std::addressof(convert_control_to_value<element_type&>(storage->m_ctrl));
+
+			decltype(element_count()) construct_index{ 0u };
+			const auto construct_values = [&element_count, &args..., &construct_index](value_allocator& alloc, element_type* const values)
+				noexcept(
+					(Construct == construct_method::value_ctor && std::is_nothrow_constructible_v<element_type, Args...>)
+					|| (Construct == construct_method::default_ctor && std::is_nothrow_default_constructible_v<element_type>)
+				) -> void
+			{
+				if (element_count() > 0)
+				{
+					const decltype(element_count()) construct_count{ element_count() };
+					const decltype(element_count()) construct_copy_count{ construct_count - 1 };
+					// Construct [0, construct_count - 1) from left-to-right by copying args.
+					while (construct_index < construct_copy_count)
+					{
+						if constexpr (Construct == construct_method::value_ctor)
+						{
+							value_allocator_traits::construct(alloc, values + construct_index, args...);
+						}
+						else
+						{
+							static_assert(sizeof...(args) == 0, "Default construction and arguments are mutually exclusive.");
+							std::uninitialized_default_construct_n(values + construct_index, 1u);
+						}
+						++construct_index;
+					}
+					// Construct [construct_count - 1] by forwarding args.
+					if constexpr (Construct == construct_method::value_ctor)
+					{
+						value_allocator_traits::construct(alloc, values + construct_index, std::forward<Args>(args)...);
+					}
+					else
+					{
+						static_assert(sizeof...(args) == 0, "Default construction and arguments are mutually exclusive.");
+						std::uninitialized_default_construct_n(values + construct_index, 1u);
+					}
+				}
+			};
+			if constexpr (noexcept(construct_values(storage->m_alloc, values)))
+			{
+				construct_values(storage->m_alloc, values);
+			}
+			else
+			{
+				try
+				{
+					construct_values(storage->m_alloc, values);
+				}
+				catch (...)
+				{
+					// Destroy [0, construct_index) from right-to-left.
+					for (auto destroy_index{ construct_index }; destroy_index > 0; )
+					{
+						--destroy_index;
+						value_allocator_traits::destroy(storage->m_alloc, values + destroy_index);
+					}
+					storage_allocator_traits::destroy(storage_alloc, storage);
+					aligned_bytes_allocator_traits::deallocate(aligned_bytes_alloc, bytes, aligned_byte_element_count);
+					throw;
+				}
+			}
+#if SH_POINTER_DEBUG_SHARED_PTR
+			storage->m_ctrl.validate_set_origin(origin(), storage->m_element_count());
 #endif // SH_POINTER_DEBUG_SHARED_PTR
+			return values;
+		}
+	};
+
+	/**	Allocate a slab of separately counted control blocks, each associated with a value of type T, using a given allocator.
+	 *	@tparam T The value type.
+	 *	@tparam Alloc The allocator type.
+	 *	@detail Each value follows its own convertible_control & so is released independently. The slab is deallocated once
+	 *		every control block within it has been deallocated.
+	 */
+	template <
+		typename T,
+		typename Alloc
+	>
+		requires (false == std::is_array_v<T>)
+	class slab_of_values_convertible_to_control final
+	{
+	private:
+		using element_type = T;
+		static_assert(alignof(element_type) <= max_alignment,
+			"element_type has extended alignment, beyond that which sh::shared_ptr expects. See sh::pointer::max_alignment.");
+
+		using allocator_traits = std::allocator_traits<Alloc>;
+		using value_allocator_traits = typename allocator_traits::template rebind_traits<element_type>;
+		using value_allocator = typename value_allocator_traits::allocator_type;
+
+		struct slab_type;
+
+		/**	A convertible control block with storage space for an associated value & a pointer to its slab.
+		 */
+		struct storage_type final
+		{
+			/**	Construct storage for an element_type.
+			 *	@param slab The slab containing this storage.
+			 */
+			explicit storage_type(slab_type* const slab) noexcept
+				: m_ctrl{ control::shared_one, slab_of_values_convertible_to_control::operations() }
+				, m_slab{ slab }
+			{
+				static_assert(is_pointer_interconvertible_with_class(&std::remove_pointer_t<decltype(this)>::m_ctrl),
+					"reinterpret_cast from convertible_control to storage_type must be valid.");
+				static_assert(offsetof(storage_type, m_value) - offsetof(storage_type, m_ctrl) == sizeof(convertible_control),
+					"convert_value_to_control only valid if m_ctrl to m_value offset is sizeof(convertible_control).");
+			}
+
+			/**	Control block convertible to and from m_value.
+			 *	@note Must be first member of storage_type as reinterpret_cast is used to convert from convertible_control.
+			 */
+			convertible_control m_ctrl;
+
+			/**	Storage space to be used for the construction of element_type.
+			 *	@note Must immediately follow and be similarly aligned to convertible_control for conversion to work.
+			 */
+			alignas(convertible_control) std::byte m_value[sizeof(element_type)];
+
+			/**	The slab containing this storage.
+			 */
+			slab_type* const m_slab;
+		};
+
+		/**	The header of a slab, followed in memory by m_element_count instances of storage_type.
+		 */
+		struct alignas(storage_type) slab_type final
+		{
+			/**	Construct a slab header.
+			 *	@param alloc The allocator to be used for constructing and destroying values.
+			 *	@param element_count The number of storage_type that follow this in memory.
+			 */
+			slab_type(value_allocator&& alloc, const std::size_t element_count) noexcept
+				: m_alloc{ std::move(alloc) }
+				, m_element_count{ element_count }
+				, m_live{ element_count }
+			{
+				static_assert(std::is_nothrow_move_constructible_v<value_allocator>,
+					"Exceptions from value_allocator move contructor aren't expected.");
+			}
+
+			/**	Return the storage_type at the given index within this slab.
+			 *	@param index The index of the storage_type, less than m_element_count.
+			 *	@return A pointer to the storage_type.
+			 */
+			storage_type* storage(const std::size_t index) noexcept
+			{
+				return reinterpret_cast<storage_type*>(this + 1) + index;
+			}
+
+			/**	Allocator used for constructing and destroying values & deallocating this slab.
+			 */
+			SH_POINTER_NO_UNIQUE_ADDRESS value_allocator m_alloc;
+
+			/**	The number of storage_type that follow this in memory.
+			 */
+			const std::size_t m_element_count;
+
+			/**	The number of storage_type within this slab that have yet to be deallocated.
+			 */
+			std::atomic<std::size_t> m_live;
+		};
+
+		/**	Trivial data type sized & aligned as max_alignment, the unit in which slab_type & its storage are allocated.
+		 */
+		struct alignas(slab_type) aligned_bytes final
+		{
+			std::byte m_bytes[alignof(slab_type)];
+
+			static_assert(sizeof(slab_type) % alignof(slab_type) == 0);
+			static_assert(sizeof(storage_type) % alignof(slab_type) == 0);
+
+			/**	Return the number of aligned_byte elements required to hold slab_type + the given count of storage_type.
+			 *	@param element_count The number of storage_type in the slab.
+			 *	@return The number of aligned_byte elements that will provide sufficient memory.
+			 */
+			static constexpr std::size_t element_count(const std::size_t element_count) noexcept
+			{
+				return (sizeof(slab_type) + element_count * sizeof(storage_type)) / sizeof(aligned_bytes);
+			}
+			/**	Return the maximum count of storage_type that can be allocated within a slab.
+			 *	@return The maximum count of storage_type.
+			 */
+			static constexpr std::size_t max_element_count() noexcept
+			{
+				return (std::numeric_limits<std::size_t>::max() - sizeof(slab_type)) / sizeof(storage_type);
+			}
+		};
+		using aligned_bytes_allocator_traits = typename allocator_traits::template rebind_traits<aligned_bytes>;
+		using aligned_bytes_allocator = typename aligned_bytes_allocator_traits::allocator_type;
+
+		/**	Destroy a slab's header & deallocate it, along with all storage_type within.
+		 *	@param slab The slab, all storage_type of which must have been destroyed.
+		 */
+		static void deallocate_slab(slab_type* const slab) noexcept
+		{
+			// Move this allocator & element_count out of the slab before destroying & deleting it.
+			aligned_bytes_allocator aligned_bytes_alloc{ std::move(slab->m_alloc) };
+			const std::size_t element_count{ slab->m_element_count };
+			std::destroy_at(slab);
+			aligned_bytes_allocator_traits::deallocate(
+				aligned_bytes_alloc,
+				reinterpret_cast<aligned_bytes*>(slab),
+				aligned_bytes::element_count(element_count));
+		}
+
+#if SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+		/**	For debug validation & profiling, return a pointer to a static string identifying this class.
+		 *	@return A pointer to a static string identifying this class.
+		 */
+		static const char* origin() noexcept
+		{
+			static const char* const instance = typeid(slab_of_values_convertible_to_control).name();
+			return instance;
+		}
+#endif // SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
 
 		/**	Return a reference to a static control_operations structure.
 		 *	@return A reference to a static control_operations structure.
 		 */
 		static const control_operations& operations() noexcept
 		{
+			static constexpr auto destruct = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_destruct(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+				storage_type& storage = reinterpret_cast<storage_type&>(static_cast<convertible_control&>(*ctrl));
+				element_type& value = convert_control_to_value<element_type&>(storage.m_ctrl);
+				value_allocator_traits::destroy(storage.m_slab->m_alloc, std::addressof(value));
+			};
+			static constexpr auto deallocate = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_deallocate(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+
+				storage_type* const storage = reinterpret_cast<storage_type*>(static_cast<convertible_control*>(ctrl));
+				slab_type* const slab = storage->m_slab;
+				std::destroy_at(storage);
+
+				if (slab->m_live.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					deallocate_slab(slab);
+				}
+			};
 			static const control_operations instance{
 #ifdef __cpp_designated_initializers
 				.m_destruct =
 #endif // __cpp_designated_initializers
-				/* destruct */
-				[](control* const ctrl) noexcept -> void
-				{
-#if SH_POINTER_DEBUG_SHARED_PTR
-					ctrl->validate_destruct(origin());
-#endif // SH_POINTER_DEBUG_SHARED_PTR
-					storage_type* const storage = backward_offset_cast<storage_type*>(
-						static_cast<convertible_control*>(ctrl),
-						std::integral_constant<std::size_t, offsetof(storage_type, m_ctrl)>{});
-
-					element_type* const values = std::addressof(convert_control_to_value<element_type&>(storage->m_ctrl));
-
-					for (element_type* cur = values + storage->m_element_count(); cur != values; )
-					{
-						--cur;
-						value_allocator_traits::destroy(storage->m_alloc, cur);
-					}
-				},
+				/* destruct */ destruct,
 #ifdef __cpp_designated_initializers
 				.m_deallocate =
 #endif // __cpp_designated_initializers
-				/* deallocate */
+				/* deallocate */ deallocate,
+#ifdef __cpp_designated_initializers
+				.m_destruct_deallocate =
+#endif // __cpp_designated_initializers
+				/* destruct_deallocate */
 				[](control* const ctrl) noexcept -> void
 				{
-#if SH_POINTER_DEBUG_SHARED_PTR
-					ctrl->validate_deallocate(origin());
-#endif // SH_POINTER_DEBUG_SHARED_PTR
-					storage_type* const storage = backward_offset_cast<storage_type*>(
-						static_cast<convertible_control*>(ctrl),
-						std::integral_constant<std::size_t, offsetof(storage_type, m_ctrl)>{});
-					aligned_bytes* const bytes = reinterpret_cast<aligned_bytes*>(storage);
-
-					// Move this allocator, element_count out of storage before destroying & deleting it.
-					storage_allocator storage_alloc{ std::move(storage->m_alloc) };
-					const count_type element_count{ std::move(storage->m_element_count) };
-					storage_allocator_traits::destroy(storage_alloc, storage);
-
-					aligned_bytes_allocator aligned_bytes_alloc{ std::move(storage_alloc) };
-					aligned_bytes_allocator_traits::deallocate(
-						aligned_bytes_alloc,
-						bytes,
-						aligned_bytes::element_count(element_count));
+					destruct(ctrl);
+					deallocate(ctrl);
 				},
 #ifdef __cpp_designated_initializers
 				.m_get_deleter =
 #endif // __cpp_designated_initializers
 				/* get_deleter */ nullptr,
-#if SH_POINTER_DEBUG_SHARED_PTR
+#if SH_POINTER_PROFILE
 #ifdef __cpp_designated_initializers
-				.m_get_element_count =
+				.m_get_origin =
 #endif // __cpp_designated_initializers
-				/* get_element_count */
-				[](const control* const ctrl) noexcept -> std::size_t
-				{
-					ctrl->validate(origin());
-					const storage_type* const storage = backward_offset_cast<const storage_type*>(
-						static_cast<const convertible_control*>(ctrl),
-						std::integral_constant<std::size_t, offsetof(storage_type, m_ctrl)>{});
-					return storage->m_element_count();
-				},
-#endif // SH_POINTER_DEBUG_SHARED_PTR
+				/* get_origin */ origin,
+#endif // SH_POINTER_PROFILE
+#if SH_POINTER_BIASED_COUNT
+#ifdef __cpp_designated_initializers
+				.m_bias_offset =
+#endif // __cpp_designated_initializers
+				/* bias_offset */ 0,
+#endif // SH_POINTER_BIASED_COUNT
 			};
 			return instance;
 		}
 
 	public:
-		/**	Allocate a control block associated with an array of values using a given allocator.
-		 *	@throw May throw std::bad_alloc or other exceptions during allocation & construction.
-		 *	@tparam Construct If no arguments are given and this is default_ctor, value may be default constructed. Otherwise uses value construction.
+		/**	Allocate a slab of control blocks, each associated with a value constructed from copies of the given arguments.
+		 *	@throw May throw std::bad_array_new_length, std::bad_alloc, or other exceptions during allocation & construction.
 		 *	@tparam Args The argument types to pass to value's constructor T::T.
-		 *	@param alloc The value allocator.
-		 *	@param element_count The number of elements of element_type to allocate in the array.
-		 *	@param args The arguments to pass to value's constructor (element_type::element_type).
-		 *	@return The pointer to the control value. Use convert_value_to_control to access the associated control block.
+		 *	@param alloc The allocator.
+		 *	@param element_count The number of values to allocate & construct. Must be greater than zero.
+		 *	@param args The arguments to pass to each value's constructor T::T.
+		 *	@return The pointer to the first value, each holding one shared reference. Use next to access those that follow.
 		 */
-		template <construct_method Construct, typename... Args>
-		static element_type* allocate_array(const Alloc& alloc, const count_type& element_count, Args&&... args)
+		template <typename... Args>
+		static element_type* allocate_n(const Alloc& alloc, const std::size_t element_count, const Args&... args)
 		{
-			static_assert(sizeof(storage_type) == sizeof(aligned_bytes));
+			SH_POINTER_ASSERT(element_count > 0,
+				"A slab must contain at least one value.");
+			if (element_count > aligned_bytes::max_element_count())
+			{
+				throw std::bad_array_new_length{};
+			}
+
 			aligned_bytes_allocator aligned_bytes_alloc{ alloc };
 			const std::size_t aligned_byte_element_count = aligned_bytes::element_count(element_count);
-
 			aligned_bytes* const bytes = aligned_bytes_allocator_traits::allocate(aligned_bytes_alloc, aligned_byte_element_count);
 
-			storage_type* const storage = reinterpret_cast<storage_type*>(bytes);
-			storage_allocator storage_alloc{ alloc };
-			storage_allocator_traits::construct(storage_alloc, storage,
-				value_allocator{ alloc },
-				element_count
-			);
-
-			element_type* const values = std::addressof(convert_control_to_value<element_type&>(storage->m_ctrl));
+			slab_type* const slab = ::new(static_cast<void*>(bytes)) slab_type{ value_allocator{ alloc }, element_count };
 
-			decltype(element_count()) construct_index{ 0u };
-			const auto construct_values = [&element_count, &args..., &construct_index](value_allocator& alloc, element_type* const values)
-				noexcept(
-					(Construct == construct_method::value_ctor && std::is_nothrow_constructible_v<element_type, Args...>)
-					|| (Construct == construct_method::default_ctor && std::is_nothrow_default_constructible_v<element_type>)
-				) -> void
+			std::size_t construct_index{ 0 };
+			const auto construct_values = [slab, &args..., &construct_index]()
+				noexcept(std::is_nothrow_constructible_v<element_type, const Args&...>) -> void
 			{
-				if (element_count() > 0)
+				for (; construct_index < slab->m_element_count; ++construct_index)
 				{
-					const decltype(element_count()) construct_count{ element_count() };
-					const decltype(element_count()) construct_copy_count{ construct_count - 1 };
-					// Construct [0, construct_count - 1) from left-to-right by copying args.
-					while (construct_index < construct_copy_count)
-					{
-						if constexpr (Construct == construct_method::value_ctor)
-						{
-							value_allocator_traits::construct(alloc, values + construct_index, args...);
-						}
-						else
-						{
-							static_assert(sizeof...(args) == 0, "Default construction and arguments are mutually exclusive.");
-							std::uninitialized_default_construct_n(values + construct_index, 1u);
-						}
-						++construct_index;
-					}
-					// Construct [construct_count - 1] by forwarding args.
-					if constexpr (Construct == construct_method::value_ctor)
-					{
-						value_allocator_traits::construct(alloc, values + construct_index, std::forward<Args>(args)...);
-					}
-					else
-					{
-						static_assert(sizeof...(args) == 0, "Default construction and arguments are mutually exclusive.");
-						std::uninitialized_default_construct_n(values + construct_index, 1u);
-					}
+					storage_type* const storage = ::new(static_cast<void*>(slab->storage(construct_index))) storage_type{ slab };
+					value_allocator_traits::construct(slab->m_alloc, reinterpret_cast<element_type*>(&storage->m_value), args...);
 				}
 			};
-			if constexpr (noexcept(construct_values(storage->m_alloc, values)))
+			if constexpr (noexcept(construct_values()))
 			{
-				construct_values(storage->m_alloc, values);
+				construct_values();
 			}
 			else
 			{
 				try
 				{
-					construct_values(storage->m_alloc, values);
+					construct_values();
 				}
 				catch (...)
 				{
+					// The storage_type at construct_index was constructed, but its value wasn't.
+					std::destroy_at(slab->storage(construct_index));
 					// Destroy [0, construct_index) from right-to-left.
-					for (auto destroy_index{ construct_index }; destroy_index > 0; )
+					for (std::size_t destroy_index{ construct_index }; destroy_index > 0; )
 					{
 						--destroy_index;
-						value_allocator_traits::destroy(storage->m_alloc, values + destroy_index);
+						storage_type* const storage = slab->storage(destroy_index);
+						value_allocator_traits::destroy(slab->m_alloc, reinterpret_cast<element_type*>(&storage->m_value));
+						std::destroy_at(storage);
 					}
-					storage_allocator_traits::destroy(storage_alloc, storage);
-					aligned_bytes_allocator_traits::deallocate(aligned_bytes_alloc, bytes, aligned_byte_element_count);
+					deallocate_slab(slab);
 					throw;
 				}
 			}
+
+			for (std::size_t index{ 0 }; index < element_count; ++index)
+			{
+				storage_type* const storage = slab->storage(index);
+				using control_from_this_type = control_from_this;
+				// See value_convertible_to_control::allocate regarding is_convertible.
+				if constexpr (std::is_convertible_v<element_type*, control_from_this_type*>)
+				{
+					auto* const control_from_value = static_cast<control_from_this_type*>(reinterpret_cast<element_type*>(&storage->m_value));
+					control_from_value->m_ctrl = &storage->m_ctrl;
+				}
 #if SH_POINTER_DEBUG_SHARED_PTR
-			storage->m_ctrl.validate_set_origin(origin());
+				storage->m_ctrl.validate_set_origin(origin());
 #endif // SH_POINTER_DEBUG_SHARED_PTR
-			return values;
+			}
+			return reinterpret_cast<element_type*>(&slab->storage(0)->m_value);
+		}
+
+		/**	Return the value following another within the same slab.
+		 *	@param value A value returned by allocate_n or next, other than the last in its slab.
+		 *	@return The pointer to the following value.
+		 */
+		static element_type* next(element_type* const value) noexcept
+		{
+			return forward_offset_cast<element_type*>(value, std::integral_constant<std::size_t, sizeof(storage_type)>{});
 		}
 	};
 
@@ -1183,7 +3379,10 @@ namespace sh::pointer
 			}
 		}
 	};
-
+	template <typename U, typename T>
+	inline constexpr bool is_destroy_trivial_v<default_allocator<U>, T>{ std::is_trivially_destructible_v<T> };
+	template <typename U>
+	inline constexpr bool is_rebind_agnostic_v<default_allocator<U>>{ true };
 } // namespace sh::pointer
 
 namespace sh
@@ -1262,18 +3461,13 @@ namespace sh
 			SH_POINTER_ASSERT(idx >= 0, "Negative index given to shared_ptr::operator[] has undefined results.");
 			if constexpr (std::is_array_v<T>)
 			{
-#if SH_POINTER_DEBUG_SHARED_PTR
-				SH_POINTER_ASSERT(
-					m_value != nullptr
-					&& (pointer::convert_value_to_control(*m_value).get_operations().m_get_element_count == nullptr
-						|| std::size_t(idx) < pointer::convert_value_to_control(*m_value).get_operations().m_get_element_count(
-							&pointer::convert_value_to_control(*m_value)
-						))
-					, "Index given to shared_ptr::operator[] is out of bounds."
-				);
-#else // !SH_POINTER_DEBUG_SHARED_PTR
 				SH_POINTER_ASSERT(m_value != nullptr, "Dereferencing nullptr shared_ptr in operator[].");
-#endif // !SH_POINTER_DEBUG_SHARED_PTR
+#if SH_POINTER_DEBUG_SHARED_PTR
+				if (m_value != nullptr)
+				{
+					pointer::convert_value_to_control(*m_value).validate_index(std::size_t(idx));
+				}
+#endif // SH_POINTER_DEBUG_SHARED_PTR
 			}
 			else
 			{
@@ -1417,14 +3611,35 @@ namespace sh
 		template <typename U> friend class weak_ptr;
 		friend struct std::atomic<sh::shared_ptr<T>>;
 
+		template <typename U, typename Alloc, typename... Args>
+			requires (false == std::is_array_v<U>)
+		friend shared_ptr<U> allocate_shared(const Alloc& alloc, Args&&... args);
+
 		template <typename U, typename Alloc, typename... Args>
 			requires (false == std::is_array_v<U>
 				&& alignof(U) <= pointer::max_alignment)
-		friend shared_ptr<U> allocate_shared(const Alloc& alloc, Args&&... args);
+		friend shared_ptr<U> allocate_shared_deferred(deferred_reclaimer& reclaimer, const Alloc& alloc, Args&&... args);
 
-		template <typename U, typename Alloc>
+		template <typename U, typename Alloc, typename OutputIt, typename... Args>
+			requires (false == std::is_array_v<U>
+				&& alignof(U) <= pointer::max_alignment)
+		friend OutputIt allocate_shared_n(const Alloc& alloc, OutputIt out, std::size_t element_count, const Args&... args);
+
+		template <typename U, typename Alloc, typename... Args>
+			requires (false == std::is_array_v<U>)
+		friend shared_ptr<U> allocate_shared_biased(const Alloc& alloc, Args&&... args);
+
+		template <typename U, typename Alloc, typename... Args>
+			requires (false == std::is_array_v<U>)
+		friend shared_ptr<U> allocate_immortal_shared(const Alloc& alloc, Args&&... args);
+
+		template <typename U, typename Alloc, typename... Args>
 			requires (false == std::is_array_v<U>
 				&& alignof(U) <= pointer::max_alignment)
+		friend shared_ptr<U> allocate_sharded_shared(const Alloc& alloc, Args&&... args);
+
+		template <typename U, typename Alloc>
+			requires (false == std::is_array_v<U>)
 		friend shared_ptr<U> allocate_shared_for_overwrite(const Alloc& alloc);
 
 		template <typename U, typename Alloc>
@@ -1467,17 +3682,41 @@ namespace sh
 		{
 			if (value)
 			{
-				pointer::convert_value_to_control(*value).shared_inc();
+				if constexpr (pointer::is_weak_free_v<element_type>)
+				{
+					pointer::convert_value_to_control(*value).weak_free_shared_inc();
+				}
+				else
+				{
+					pointer::convert_value_to_control(*value).shared_inc();
+				}
 			}
 		}
+#if defined(__GNUC__) && !defined(__clang__)
+		// GCC inlines the last reference's release into callers that also see a value that has no control block (e.g.,
+		// an int adopted by wide_shared_ptr, whose collapse to a shared_ptr would throw), then warns that the control
+		// block preceding that value is out of bounds. Only values created with a convertible_control reach here.
+		#pragma GCC diagnostic push
+		#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif // __GNUC__ && !__clang__
 		static void decrement(element_type* const value) noexcept
 		{
 			if (value)
 			{
 				pointer::convertible_control& ctrl = pointer::convert_value_to_control(*value);
-				ctrl.shared_dec();
+				if constexpr (pointer::is_weak_free_v<element_type>)
+				{
+					ctrl.weak_free_shared_dec();
+				}
+				else
+				{
+					ctrl.shared_dec();
+				}
 			}
 		}
+#if defined(__GNUC__) && !defined(__clang__)
+		#pragma GCC diagnostic pop
+#endif // __GNUC__ && !__clang__
 
 		/**	Constructor for internal use that accepts a value associated with a convertible_control that has a shared_inc that this shared_ptr will assume.
 		 *	@param value_with_one_ref A value associated with a convertible_control with a shared_inc to assume.
@@ -1632,6 +3871,7 @@ namespace sh
 		weak_ptr(const shared_ptr<U>& other) noexcept
 			: m_ctrl{ pointer::convert_value_to_control(other.get()) }
 		{
+			static_assert(false == pointer::is_weak_free_v<U>, "sh::weak_ptr can't reference weak-free types.");
 			increment(m_ctrl);
 		}
 		template <typename U>
@@ -1639,6 +3879,7 @@ namespace sh
 				&& is_pointer_interconvertible_v<U, T>)
 		weak_ptr& operator=(const shared_ptr<U>& other) noexcept
 		{
+			static_assert(false == pointer::is_weak_free_v<U>, "sh::weak_ptr can't reference weak-free types.");
 			pointer::convertible_control* const ctrl = pointer::convert_value_to_control(other.get());
 			increment(ctrl);
 			decrement(m_ctrl);
@@ -1655,6 +3896,7 @@ namespace sh
 
 		static void increment(pointer::convertible_control* const ctrl) noexcept
 		{
+			static_assert(false == pointer::is_weak_free_v<element_type>, "sh::weak_ptr can't reference weak-free types.");
 			if (ctrl)
 			{
 				ctrl->weak_inc();
@@ -1692,8 +3934,7 @@ namespace sh
 		typename Alloc,
 		typename... Args
 	>
-		requires (false == std::is_array_v<T>
-			&& alignof(T) <= pointer::max_alignment)
+		requires (false == std::is_array_v<T>)
 	shared_ptr<T> allocate_shared(const Alloc& alloc, Args&&... args)
 	{
 		using element_type = std::remove_const_t<T>;
@@ -1705,6 +3946,79 @@ namespace sh
 			)
 		};
 	}
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T using the supplied allocator, counting
+	 *	shared references biased toward the calling thread.
+	 *	@detail References taken & released by the calling thread are counted without atomic read-modify-write
+	 *		operations until it releases its last, whereupon counting merges into a single atomic count. Other threads
+	 *		count atomically. Without SH_POINTER_BIASED_COUNT, equivalent to allocate_shared.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Alloc The allocator type to use for construction and destruction.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param alloc The allocator to use.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename Alloc,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>)
+	shared_ptr<T> allocate_shared_biased(const Alloc& alloc, Args&&... args)
+	{
+		static_assert(false == pointer::is_weak_free_v<T>, "Weak-free types can't be biased.");
+#if SH_POINTER_BIASED_COUNT
+		using element_type = std::remove_const_t<T>;
+		using origin_type = pointer::value_convertible_to_control<element_type, Alloc, true>;
+		return shared_ptr<T>{
+			origin_type::template allocate<pointer::construct_method::value_ctor>(
+				alloc,
+				std::forward<Args>(args)...
+			)
+		};
+#else // !SH_POINTER_BIASED_COUNT
+		return sh::allocate_shared<T>(alloc, std::forward<Args>(args)...);
+#endif // !SH_POINTER_BIASED_COUNT
+	}
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T using the supplied allocator, in an immortal
+	 *	control block.
+	 *	@detail Copying & releasing references to an immortal control block only reads its counter, skipping the atomic
+	 *		read-modify-writes that would otherwise contend on its cache line. weak_ptr::lock always succeeds &
+	 *		use_count always returns pointer::immortal_use_count. Intended for global singletons & interned constants.
+	 *		Without SH_POINTER_SPECIAL_COUNT, the control block instead keeps one reference that's never released, so
+	 *		references are counted as for allocate_shared.
+	 *	@note The element is never destructed & its storage is never deallocated.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Alloc The allocator type to use for construction.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param alloc The allocator to use.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename Alloc,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>)
+	shared_ptr<T> allocate_immortal_shared(const Alloc& alloc, Args&&... args)
+	{
+		static_assert(false == pointer::is_weak_free_v<T>, "Weak-free types can't be immortal.");
+		using element_type = std::remove_const_t<T>;
+		using origin_type = pointer::value_convertible_to_control<element_type, Alloc>;
+		element_type* const value = origin_type::template allocate<pointer::construct_method::value_ctor>(
+			alloc,
+			std::forward<Args>(args)...
+		);
+#if SH_POINTER_SPECIAL_COUNT
+		pointer::convert_value_to_control(*value).make_immortal();
+#else // !SH_POINTER_SPECIAL_COUNT
+		pointer::convert_value_to_control(*value).shared_inc();
+#endif // !SH_POINTER_SPECIAL_COUNT
+		return shared_ptr<T>{ value };
+	}
 	/**	Constructs a sh::shared_ptr to own a (default initialized) element T using the supplied allocator.
 	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
 	 *	@tparam T The type of element to construct.
@@ -1716,8 +4030,7 @@ namespace sh
 		typename T,
 		typename Alloc
 	>
-		requires (false == std::is_array_v<T>
-			&& alignof(T) <= pointer::max_alignment)
+		requires (false == std::is_array_v<T>)
 	shared_ptr<T> allocate_shared_for_overwrite(const Alloc& alloc)
 	{
 		using element_type = std::remove_const_t<T>;
@@ -1917,8 +4230,7 @@ namespace sh
 		typename T,
 		typename... Args
 	>
-		requires (false == std::is_array_v<T>
-			&& alignof(T) <= pointer::max_alignment)
+		requires (false == std::is_array_v<T>)
 	shared_ptr<T> make_shared(Args&&... args)
 	{
 		return sh::allocate_shared<T>(
@@ -1926,14 +4238,53 @@ namespace sh
 			std::forward<Args>(args)...
 		);
 	}
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T, counting shared references biased toward
+	 *	the calling thread. See allocate_shared_biased.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>)
+	shared_ptr<T> make_shared_biased(Args&&... args)
+	{
+		return sh::allocate_shared_biased<T>(
+			pointer::default_allocator<std::remove_const_t<T>>{},
+			std::forward<Args>(args)...
+		);
+	}
+	/**	Constructs a sh::shared_ptr to own a (value initialized) element T in an immortal control block. See
+	 *	allocate_immortal_shared.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param args The arguments passed to the constructor of T.
+	 *	@return A non-null sh::shared_ptr owning the element T.
+	 */
+	template <
+		typename T,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>)
+	shared_ptr<T> make_immortal_shared(Args&&... args)
+	{
+		return sh::allocate_immortal_shared<T>(
+			pointer::default_allocator<std::remove_const_t<T>>{},
+			std::forward<Args>(args)...
+		);
+	}
 	/**	Constructs a sh::shared_ptr to own a (default initialized) element T.
 	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
 	 *	@tparam T The type of element to construct.
 	 *	@return A non-null sh::shared_ptr owning the element T.
 	 */
 	template <typename T>
-		requires (false == std::is_array_v<T>
-			&& alignof(T) <= pointer::max_alignment)
+		requires (false == std::is_array_v<T>)
 	shared_ptr<T> make_shared_for_overwrite()
 	{
 		using element_type = std::remove_const_t<T>;
@@ -2031,6 +4382,95 @@ namespace sh
 		return sh::allocate_shared_for_overwrite<T>(pointer::default_allocator<element_type>{});
 	}
 
+	/**	Constructs \p element_count separately owned elements T within a single allocation from the supplied allocator,
+	 *	writing a sh::shared_ptr to each to an output iterator.
+	 *	@detail Each element has its own control block & may be released independently of the others. The allocation
+	 *		is deallocated once every element's control block has been released.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor or \p out. If \p out throws, elements not
+	 *		yet written are released.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam Alloc The allocator type to use for construction and destruction.
+	 *	@tparam OutputIt An output iterator to which sh::shared_ptr<T> may be assigned.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param alloc The allocator to use.
+	 *	@param out The output iterator to which to write each sh::shared_ptr<T>.
+	 *	@param element_count The number of elements to construct.
+	 *	@param args The arguments passed to the constructor of each T, copied for each.
+	 *	@return The output iterator following the last written sh::shared_ptr<T>.
+	 */
+	template <
+		typename T,
+		typename Alloc,
+		typename OutputIt,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>
+			&& alignof(T) <= pointer::max_alignment)
+	OutputIt allocate_shared_n(const Alloc& alloc, OutputIt out, const std::size_t element_count, const Args&... args)
+	{
+		using element_type = std::remove_const_t<T>;
+		using origin_type = pointer::slab_of_values_convertible_to_control<element_type, Alloc>;
+		if (element_count == 0)
+		{
+			return out;
+		}
+		element_type* value = origin_type::allocate_n(alloc, element_count, args...);
+		std::size_t index{ 0 };
+		try
+		{
+			for (;;)
+			{
+				shared_ptr<T> owner{ value };
+				++index;
+				*out = std::move(owner);
+				++out;
+				if (index == element_count)
+				{
+					break;
+				}
+				value = origin_type::next(value);
+			}
+		}
+		catch (...)
+		{
+			// Release the references of elements not yet written.
+			for (; index < element_count; ++index)
+			{
+				value = origin_type::next(value);
+				const shared_ptr<T> owner{ value };
+			}
+			throw;
+		}
+		return out;
+	}
+	/**	Constructs \p element_count separately owned elements T within a single allocation, writing a sh::shared_ptr to
+	 *	each to an output iterator. See allocate_shared_n.
+	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor or \p out.
+	 *	@tparam T The type of element to construct.
+	 *	@tparam OutputIt An output iterator to which sh::shared_ptr<T> may be assigned.
+	 *	@tparam Args The types of arguments passed to T's constructor.
+	 *	@param out The output iterator to which to write each sh::shared_ptr<T>.
+	 *	@param element_count The number of elements to construct.
+	 *	@param args The arguments passed to the constructor of each T, copied for each.
+	 *	@return The output iterator following the last written sh::shared_ptr<T>.
+	 */
+	template <
+		typename T,
+		typename OutputIt,
+		typename... Args
+	>
+		requires (false == std::is_array_v<T>
+			&& alignof(T) <= pointer::max_alignment)
+	OutputIt make_shared_n(OutputIt out, const std::size_t element_count, const Args&... args)
+	{
+		return sh::allocate_shared_n<T>(
+			pointer::default_allocator<std::remove_const_t<T>>{},
+			std::move(out),
+			element_count,
+			args...
+		);
+	}
+
 	// shared_ptr -> shared_ptr casts:
 	template <
 		typename T,
@@ -2232,6 +4672,29 @@ namespace sh
 
 } // namespace sh
 
+#if defined(SH_POINTER_EXTERN_TEMPLATE)
+namespace sh
+{
+	// Arrays of bytes, as used for buffers:
+	SH_POINTER_EXTERN_TEMPLATE struct pointer::default_allocator<char>;
+	SH_POINTER_EXTERN_TEMPLATE struct pointer::default_allocator<std::byte>;
+	SH_POINTER_EXTERN_TEMPLATE class pointer::array_of_values_convertible_to_control<
+		char[], pointer::default_allocator<char>, pointer::integral<std::size_t>>;
+	SH_POINTER_EXTERN_TEMPLATE class pointer::array_of_values_convertible_to_control<
+		std::byte[], pointer::default_allocator<std::byte>, pointer::integral<std::size_t>>;
+	SH_POINTER_EXTERN_TEMPLATE class shared_ptr<char[]>;
+	SH_POINTER_EXTERN_TEMPLATE class shared_ptr<std::byte[]>;
+	SH_POINTER_EXTERN_TEMPLATE class weak_ptr<char[]>;
+	SH_POINTER_EXTERN_TEMPLATE class weak_ptr<std::byte[]>;
+	SH_POINTER_EXTERN_TEMPLATE shared_ptr<char[]> make_shared<char[]>(std::size_t);
+	SH_POINTER_EXTERN_TEMPLATE shared_ptr<char[]> make_shared<char[]>(std::size_t, const char&);
+	SH_POINTER_EXTERN_TEMPLATE shared_ptr<char[]> make_shared_for_overwrite<char[]>(std::size_t);
+	SH_POINTER_EXTERN_TEMPLATE shared_ptr<std::byte[]> make_shared<std::byte[]>(std::size_t);
+	SH_POINTER_EXTERN_TEMPLATE shared_ptr<std::byte[]> make_shared<std::byte[]>(std::size_t, const std::byte&);
+	SH_POINTER_EXTERN_TEMPLATE shared_ptr<std::byte[]> make_shared_for_overwrite<std::byte[]>(std::size_t);
+} // namespace sh
+#endif // SH_POINTER_EXTERN_TEMPLATE
+
 namespace std
 {
 	template <typename T>
@@ -151,8 +151,8 @@ namespace sh::pointer
 		using storage_allocator_traits = typename std::allocator_traits<Alloc>::template rebind_traits<storage_type>;
 		using storage_allocator = typename storage_allocator_traits::allocator_type;
 
-#if SH_POINTER_DEBUG_SHARED_PTR
-		/**	For debug validation, return a pointer to a static string identifying this class.
+#if SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
+		/**	For debug validation & profiling, return a pointer to a static string identifying this class.
 		 *	@return A pointer to a static string identifying this class.
 		 */
 		static const char* origin() noexcept
@@ -160,49 +160,58 @@ namespace sh::pointer
 			static const char* const instance = typeid(external_value_control).name();
 			return instance;
 		}
-#endif // SH_POINTER_DEBUG_SHARED_PTR
+#endif // SH_POINTER_DEBUG_SHARED_PTR || SH_POINTER_PROFILE
 
 		/**	Return a reference to a static control_operations structure.
 		 *	@return A reference to a static control_operations structure.
 		 */
 		static const control_operations& operations() noexcept
 		{
+			static constexpr auto destruct = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_destruct(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+				storage_type* const storage = static_cast<storage_type*>(ctrl);
+				if constexpr (std::is_invocable_v<deleter_type, element_type*, count_type, value_allocator&>)
+				{
+					// allocate_shared et al need extra data that we already store. Pass it along to
+					// what's presumably external_value_deleter so that it doesn't need to be stored
+					// redundantly.
+					storage->m_deleter(storage->m_value, storage->m_element_count, storage->m_alloc);
+				}
+				else
+				{
+					storage->m_deleter(storage->m_value);
+				}
+			};
+			static constexpr auto deallocate = [](control* const ctrl) noexcept -> void
+			{
+#if SH_POINTER_DEBUG_SHARED_PTR
+				ctrl->validate_deallocate(origin());
+#endif // SH_POINTER_DEBUG_SHARED_PTR
+				storage_type* const storage = static_cast<storage_type*>(ctrl);
+				storage_allocator storage_allocator{ std::move(storage->m_alloc) };
+				storage_allocator_traits::destroy(storage_allocator, storage);
+				storage_allocator_traits::deallocate(storage_allocator, storage, 1);
+			};
 			const static control_operations instance{
 #ifdef __cpp_designated_initializers
 				.m_destruct =
 #endif // __cpp_designated_initializers
-				/* destruct */
-				[](control* const ctrl) noexcept -> void
-				{
-#if SH_POINTER_DEBUG_SHARED_PTR
-					ctrl->validate_destruct(origin());
-#endif // SH_POINTER_DEBUG_SHARED_PTR
-					storage_type* const storage = static_cast<storage_type*>(ctrl);
-					if constexpr (std::is_invocable_v<deleter_type, element_type*, count_type, value_allocator&>)
-					{
-						// allocate_shared et al need extra data that we already store. Pass it along to
-						// what's presumably external_value_deleter so that it doesn't need to be stored
-						// redundantly.
-						storage->m_deleter(storage->m_value, storage->m_element_count, storage->m_alloc);
-					}
-					else
-					{
-						storage->m_deleter(storage->m_value);
-					}
-				},
+				/* destruct */ destruct,
 #ifdef __cpp_designated_initializers
 				.m_deallocate =
 #endif // __cpp_designated_initializers
-				/* deallocate */
+				/* deallocate */ deallocate,
+#ifdef __cpp_designated_initializers
+				.m_destruct_deallocate =
+#endif // __cpp_designated_initializers
+				/* destruct_deallocate */
 				[](control* const ctrl) noexcept -> void
 				{
-#if SH_POINTER_DEBUG_SHARED_PTR
-					ctrl->validate_deallocate(origin());
-#endif // SH_POINTER_DEBUG_SHARED_PTR
-					storage_type* const storage = static_cast<storage_type*>(ctrl);
-					storage_allocator storage_allocator{ std::move(storage->m_alloc) };
-					storage_allocator_traits::destroy(storage_allocator, storage);
-					storage_allocator_traits::deallocate(storage_allocator, storage, 1);
+					destruct(ctrl);
+					deallocate(ctrl);
 				},
 #ifdef __cpp_designated_initializers
 				.m_get_deleter =
@@ -216,18 +225,12 @@ namespace sh::pointer
 					storage_type* const storage = static_cast<storage_type*>(ctrl);
 					return &storage->m_deleter;
 				},
-#if SH_POINTER_DEBUG_SHARED_PTR
+#if SH_POINTER_PROFILE
 #ifdef __cpp_designated_initializers
-				.m_get_element_count =
+				.m_get_origin =
 #endif // __cpp_designated_initializers
-				/* get_element_count */
-				[](const control* const ctrl) noexcept -> std::size_t
-				{
-					ctrl->validate(origin());
-					const storage_type* const storage = static_cast<const storage_type*>(ctrl);
-					return storage->m_element_count();
-				},
-#endif // SH_POINTER_DEBUG_SHARED_PTR
+				/* get_origin */ origin,
+#endif // SH_POINTER_PROFILE
 			};
 			return instance;
 		}
@@ -250,7 +253,7 @@ namespace sh::pointer
 				"storage_type constructor expected to be noexcept.");
 			storage_allocator_traits::construct(storage_alloc, storage, value, element_count, std::move(deleter), alloc);
 #if SH_POINTER_DEBUG_SHARED_PTR
-			storage->validate_set_origin(origin());
+			storage->validate_set_origin(origin(), storage->m_element_count());
 #endif // SH_POINTER_DEBUG_SHARED_PTR
 			return storage;
 		}
@@ -715,11 +718,10 @@ namespace sh
 			if constexpr (std::is_array_v<T>)
 			{
 #if SH_POINTER_DEBUG_SHARED_PTR
-				SH_POINTER_ASSERT(m_ctrl == nullptr
-					|| m_ctrl->get_operations().m_get_element_count == nullptr
-					|| std::size_t(idx) < m_ctrl->get_operations().m_get_element_count(m_ctrl)
-					, "Index given to wide_shared_ptr::operator[] is out of bounds."
-				);
+				if (m_ctrl != nullptr)
+				{
+					m_ctrl->validate_index(std::size_t(idx));
+				}
 #endif // SH_POINTER_DEBUG_SHARED_PTR
 			}
 			else
@@ -921,16 +923,6 @@ namespace sh
 		template <typename U> friend class enable_shared_from_this;
 		friend struct std::atomic<wide_shared_ptr<T>>;
 
-		template <typename U, typename Alloc, typename... Args>
-			requires (false == std::is_array_v<U>
-				&& alignof(U) > pointer::max_alignment)
-		friend wide_shared_ptr<U> allocate_shared(const Alloc& alloc, Args&&... args);
-
-		template <typename U, typename Alloc>
-			requires (false == std::is_array_v<U>
-				&& alignof(U) > pointer::max_alignment)
-		friend wide_shared_ptr<U> allocate_shared_for_overwrite(const Alloc& alloc);
-
 		template <typename U, typename Alloc>
 			requires (std::is_array_v<U>
 				&& std::extent_v<U> == 0
@@ -1278,12 +1270,14 @@ namespace sh
 			: m_ctrl{ other.m_ctrl }
 			, m_value{ other.m_value }
 		{
+			static_assert(false == pointer::is_weak_free_v<std::remove_extent_t<U>>, "sh::wide_weak_ptr can't reference weak-free types.");
 			increment(m_ctrl);
 		}
 		template <typename U>
 			requires std::is_convertible_v<U*, T*>
 		wide_weak_ptr& operator=(const wide_shared_ptr<U>& other) noexcept
 		{
+			static_assert(false == pointer::is_weak_free_v<std::remove_extent_t<U>>, "sh::wide_weak_ptr can't reference weak-free types.");
 			increment(other.m_ctrl);
 			decrement(m_ctrl);
 			m_ctrl = other.m_ctrl;
@@ -1298,12 +1292,14 @@ namespace sh
 			: m_ctrl{ pointer::convert_value_to_control(other.m_value) }
 			, m_value{ other.m_value }
 		{
+			static_assert(false == pointer::is_weak_free_v<std::remove_extent_t<U>>, "sh::wide_weak_ptr can't reference weak-free types.");
 			increment(m_ctrl);
 		}
 		template <typename U>
 			requires std::is_convertible_v<U*, T*>
 		wide_weak_ptr& operator=(const shared_ptr<U>& other) noexcept
 		{
+			static_assert(false == pointer::is_weak_free_v<std::remove_extent_t<U>>, "sh::wide_weak_ptr can't reference weak-free types.");
 			element_type* const value = other.m_value;
 			pointer::control* const ctrl = pointer::convert_value_to_control(value);
 			increment(ctrl);
@@ -1323,6 +1319,7 @@ namespace sh
 
 		static void increment(pointer::control* const ctrl) noexcept
 		{
+			static_assert(false == pointer::is_weak_free_v<element_type>, "sh::wide_weak_ptr can't reference weak-free types.");
 			if (ctrl)
 			{
 				ctrl->weak_inc();
@@ -1353,62 +1350,6 @@ namespace sh
 		element_type* m_value;
 	};
 
-	/**	Constructs a sh::wide_shared_ptr to own a (value initialized) element T using the supplied allocator.
-	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
-	 *	@tparam T The type of element to construct.
-	 *	@tparam Alloc The allocator type to use for construction and destruction.
-	 *	@tparam Args The types of arguments passed to T's constructor.
-	 *	@param alloc The allocator to use.
-	 *	@param args The arguments passed to the constructor of T.
-	 *	@return A non-null sh::wide_shared_ptr owning the element T.
-	 */
-	template <
-		typename T,
-		typename Alloc,
-		typename... Args
-	>
-		requires (false == std::is_array_v<T>
-			&& alignof(T) > pointer::max_alignment)
-	wide_shared_ptr<T> allocate_shared(const Alloc& alloc, Args&&... args)
-	{
-		static constexpr std::integral_constant<std::size_t, 1> element_count;
-		auto [control, value] = pointer::external_value_control<
-				T,
-				decltype(element_count),
-				pointer::external_value_deleter<T>,
-				Alloc
-			>::template allocate<
-				pointer::construct_method::value_ctor
-			>(pointer::external_value_deleter<T>{}, alloc, std::forward<Args>(args)...);
-		return wide_shared_ptr<T>{ control, value };
-	}
-	/**	Constructs a sh::wide_shared_ptr to own a (default initialized) element T using the supplied allocator.
-	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
-	 *	@tparam T The type of element to construct.
-	 *	@tparam Alloc The allocator type to use for construction and destruction.
-	 *	@param alloc The allocator to use.
-	 *	@return A non-null sh::wide_shared_ptr owning the element T.
-	 */
-	template <
-		typename T,
-		typename Alloc
-	>
-		requires (false == std::is_array_v<T>
-			&& alignof(T) > pointer::max_alignment)
-	wide_shared_ptr<T> allocate_shared_for_overwrite(const Alloc& alloc)
-	{
-		static constexpr std::integral_constant<std::size_t, 1> element_count;
-		auto [control, value] = pointer::external_value_control<
-				T,
-				decltype(element_count),
-				pointer::external_value_deleter<T>,
-				Alloc
-			>::template allocate<
-				pointer::construct_method::default_ctor
-			>(pointer::external_value_deleter<T>{}, alloc);
-		return wide_shared_ptr<T>{ control, value };
-	}
-
 	/**	Constructs via a supplied allocator a sh::wide_shared_ptr to own an array of \p element_count (value initialized) elements of T.
 	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
 	 *	@tparam T The type of element to construct.
@@ -1571,36 +1512,6 @@ namespace sh
 		return wide_shared_ptr<T>{ control, value };
 	}
 
-	/**	Constructs a sh::wide_shared_ptr to own a (value initialized) element T.
-	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
-	 *	@tparam T The type of element to construct.
-	 *	@tparam Args The types of arguments passed to T's constructor.
-	 *	@param args The arguments passed to the constructor of T.
-	 *	@return A non-null sh::wide_shared_ptr owning the element T.
-	 */
-	template <
-		typename T,
-		typename... Args
-	>
-		requires (false == std::is_array_v<T>
-			&& alignof(T) > pointer::max_alignment)
-	wide_shared_ptr<T> make_shared(Args&&... args)
-	{
-		return sh::allocate_shared<T>(pointer::default_allocator<T>{}, std::forward<Args>(args)...);
-	}
-	/**	Constructs a sh::wide_shared_ptr to own a (default initialized) element T.
-	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
-	 *	@tparam T The type of element to construct.
-	 *	@return A non-null sh::wide_shared_ptr owning the element T.
-	 */
-	template <typename T>
-		requires (false == std::is_array_v<T>
-			&& alignof(T) > pointer::max_alignment)
-	wide_shared_ptr<T> make_shared_for_overwrite()
-	{
-		return sh::allocate_shared_for_overwrite<T>(pointer::default_allocator<T>{});
-	}
-
 	/**	Constructs a sh::wide_shared_ptr to own an array of \p element_count (value initialized) elements of T.
 	 *	@throw May throw std::bad_alloc or other exceptions from T's constructor.
 	 *	@tparam T The type of element to construct.
@@ -1962,6 +1873,19 @@ namespace sh
 
 } // namespace sh
 
+#if defined(SH_POINTER_EXTERN_TEMPLATE)
+namespace sh
+{
+	// Arrays of bytes owned from raw pointers, as used for buffers:
+	SH_POINTER_EXTERN_TEMPLATE class pointer::external_value_control<
+		char[], pointer::unknown_count, std::default_delete<char[]>, pointer::default_allocator<void>>;
+	SH_POINTER_EXTERN_TEMPLATE class pointer::external_value_control<
+		std::byte[], pointer::unknown_count, std::default_delete<std::byte[]>, pointer::default_allocator<void>>;
+	SH_POINTER_EXTERN_TEMPLATE class wide_shared_ptr<char[]>;
+	SH_POINTER_EXTERN_TEMPLATE class wide_shared_ptr<std::byte[]>;
+} // namespace sh
+#endif // SH_POINTER_EXTERN_TEMPLATE
+
 namespace std
 {
 	template <typename T>
@@ -33,6 +33,7 @@
 
 #include <sh/atomic_shared_ptr.hpp>
 #include <thread>
+#include <vector>
 
 using sh::atomic_shared_ptr;
 using sh::atomic_weak_ptr;
@@ -224,6 +225,66 @@ TEST(sh_atomic_shared_ptr, atomic_shared_ptr_notify_all)
 	t1.join();
 	t2.join();
 }
+TEST(sh_atomic_shared_ptr, atomic_shared_ptr_is_lock_free)
+{
+	const atomic_shared_ptr<int> x;
+	EXPECT_EQ(x.is_lock_free(), atomic_shared_ptr<int>::is_always_lock_free);
+#if SH_POINTER_ATOMIC_HIGH_BITS > 0
+	EXPECT_TRUE(atomic_shared_ptr<int>::is_always_lock_free);
+#endif // SH_POINTER_ATOMIC_HIGH_BITS > 0
+}
+TEST(sh_atomic_shared_ptr, atomic_shared_ptr_concurrent)
+{
+	constexpr int thread_count = 4;
+	constexpr int iterations = 10000;
+	const sh::shared_ptr<int> values[2]{ sh::make_shared<int>(123), sh::make_shared<int>(456) };
+	atomic_shared_ptr<int> z{ values[0] };
+
+	std::vector<std::thread> threads;
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([&values, &z, thread_index]()
+		{
+			for (int index = 0; index < iterations; ++index)
+			{
+				const sh::shared_ptr<int>& desired = values[(index + thread_index) & 1];
+				switch ((index + thread_index) % 4)
+				{
+				case 0:
+					z.store(desired);
+					break;
+				case 1:
+					(void)z.exchange(desired);
+					break;
+				case 2:
+				{
+					sh::shared_ptr<int> expected = z.load();
+					(void)z.compare_exchange_strong(expected, desired);
+					break;
+				}
+				default:
+				{
+					const sh::shared_ptr<int> loaded = z.load();
+					ASSERT_TRUE(loaded == values[0] || loaded == values[1]);
+					break;
+				}
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	// Every borrowed count has been transferred or returned.
+	const sh::shared_ptr<int> loaded = z.load();
+	EXPECT_EQ(values[0].use_count() + values[1].use_count(), 4u);
+	EXPECT_EQ(loaded.use_count(), 3u);
+	z.store(nullptr);
+	EXPECT_EQ(values[0].use_count(), loaded == values[0] ? 2u : 1u);
+	EXPECT_EQ(values[1].use_count(), loaded == values[1] ? 2u : 1u);
+}
 
 TEST(sh_atomic_weak_ptr, atomic_weak_ptr_ctor_default)
 {
@@ -438,3 +499,52 @@ TEST(sh_atomic_weak_ptr, atomic_weak_ptr_notify_all)
 	t1.join();
 	t2.join();
 }
+TEST(sh_atomic_weak_ptr, atomic_weak_ptr_concurrent)
+{
+	constexpr int thread_count = 4;
+	constexpr int iterations = 10000;
+	const sh::shared_ptr<int> values[2]{ sh::make_shared<int>(123), sh::make_shared<int>(456) };
+	atomic_weak_ptr<int> z{ values[0] };
+
+	std::vector<std::thread> threads;
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([&values, &z, thread_index]()
+		{
+			for (int index = 0; index < iterations; ++index)
+			{
+				const sh::weak_ptr<int> desired{ values[(index + thread_index) & 1] };
+				switch ((index + thread_index) % 4)
+				{
+				case 0:
+					z.store(desired);
+					break;
+				case 1:
+					(void)z.exchange(desired);
+					break;
+				case 2:
+				{
+					sh::weak_ptr<int> expected = z.load();
+					(void)z.compare_exchange_strong(expected, desired);
+					break;
+				}
+				default:
+				{
+					const sh::shared_ptr<int> locked = z.load().lock();
+					ASSERT_TRUE(locked == values[0] || locked == values[1]);
+					break;
+				}
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	// Only the values themselves hold shared references.
+	EXPECT_EQ(values[0].use_count(), 1u);
+	EXPECT_EQ(values[1].use_count(), 1u);
+	EXPECT_FALSE(z.load().expired());
+}
@@ -33,6 +33,7 @@
 
 #include <sh/atomic_wide_shared_ptr.hpp>
 #include <thread>
+#include <vector>
 
 using sh::atomic_wide_shared_ptr;
 using sh::atomic_wide_weak_ptr;
@@ -343,6 +344,150 @@ TEST(sh_atomic_wide_shared_ptr, atomic_wide_shared_ptr_notify_all)
 	t1.join();
 	t2.join();
 }
+TEST(sh_atomic_wide_shared_ptr, atomic_wide_shared_ptr_is_lock_free)
+{
+	const atomic_wide_shared_ptr<int> x;
+	EXPECT_EQ(x.is_lock_free(), atomic_wide_shared_ptr<int>::is_always_lock_free);
+	EXPECT_EQ(atomic_wide_shared_ptr<int>::is_always_lock_free, SH_POINTER_DWCAS != 0);
+}
+
+namespace
+{
+	/**	Exercise an implementation of the atomic control & value pair behind atomic wide_shared_ptr directly, such
+	 *	that both the lock free & spin lock implementations are tested wherever the former is available.
+	 *	@tparam AtomicControlAndValue The implementation to test.
+	 */
+	template <typename AtomicControlAndValue>
+	void test_atomic_control_and_value()
+	{
+		using policy = sh::pointer::shared_policy;
+		constexpr std::memory_order order = std::memory_order_seq_cst;
+		const sh::shared_ptr<int> x{ sh::make_shared<int>(123) };
+		const sh::shared_ptr<int> y{ sh::make_shared<int>(456) };
+		int other = 789;
+		// Return the control of a shared_ptr with a new increment for the atomic to inherit:
+		const auto inc = [](const sh::shared_ptr<int>& p) -> sh::pointer::control*
+		{
+			sh::pointer::control* const ctrl = sh::pointer::convert_value_to_control(p.get());
+			policy::increment(ctrl);
+			return ctrl;
+		};
+		sh::pointer::control* const x_ctrl = sh::pointer::convert_value_to_control(x.get());
+		sh::pointer::control* const y_ctrl = sh::pointer::convert_value_to_control(y.get());
+
+		{
+			AtomicControlAndValue z{ inc(x), x.get() };
+			EXPECT_EQ(x.use_count(), 2u);
+			{
+				const auto [ctrl, value] = z.load(order);
+				EXPECT_EQ(ctrl, x_ctrl);
+				EXPECT_EQ(value, x.get());
+				EXPECT_EQ(x.use_count(), 3u);
+				policy::decrement(ctrl);
+			}
+
+			z.store(inc(y), y.get(), order);
+			EXPECT_EQ(x.use_count(), 1u);
+			EXPECT_EQ(y.use_count(), 2u);
+			{
+				const auto [ctrl, value] = z.exchange(inc(x), x.get(), order);
+				EXPECT_EQ(ctrl, y_ctrl);
+				EXPECT_EQ(value, y.get());
+				EXPECT_EQ(y.use_count(), 2u);
+				policy::decrement(ctrl);
+				EXPECT_EQ(y.use_count(), 1u);
+			}
+			{
+				sh::pointer::control* expected_ctrl = inc(y);
+				void* expected_value = y.get();
+				EXPECT_FALSE(z.compare_exchange_strong(expected_ctrl, expected_value, inc(y), y.get(), order));
+				EXPECT_EQ(expected_ctrl, x_ctrl);
+				EXPECT_EQ(expected_value, x.get());
+				EXPECT_EQ(x.use_count(), 3u);
+				EXPECT_EQ(y.use_count(), 1u);
+				// Same control, but a different value:
+				expected_value = &other;
+				EXPECT_FALSE(z.compare_exchange_strong(expected_ctrl, expected_value, inc(y), y.get(), order));
+				EXPECT_EQ(expected_value, x.get());
+				EXPECT_EQ(x.use_count(), 3u);
+				EXPECT_TRUE(z.compare_exchange_strong(expected_ctrl, expected_value, inc(y), y.get(), order));
+				EXPECT_EQ(x.use_count(), 2u);
+				EXPECT_EQ(y.use_count(), 2u);
+				policy::decrement(expected_ctrl);
+				EXPECT_EQ(x.use_count(), 1u);
+			}
+			{
+				// Changing only the value must wake waiters:
+				std::thread waiter{
+					[&]() { z.wait(y_ctrl, y.get(), std::memory_order_acquire); }
+				};
+				z.store(inc(y), &other, order);
+				z.notify_all();
+				waiter.join();
+				const auto [ctrl, value] = z.load(order);
+				EXPECT_EQ(ctrl, y_ctrl);
+				EXPECT_EQ(value, &other);
+				policy::decrement(ctrl);
+				EXPECT_EQ(y.use_count(), 2u);
+			}
+		}
+		EXPECT_EQ(y.use_count(), 1u);
+
+		{
+			constexpr int thread_count = 4;
+			constexpr int iterations = 10000;
+			AtomicControlAndValue z{ inc(x), x.get() };
+			std::vector<std::thread> threads;
+			for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+			{
+				threads.emplace_back([&, thread_index]()
+				{
+					for (int index = 0; index < iterations; ++index)
+					{
+						const sh::shared_ptr<int>& desired = (index + thread_index) & 1 ? y : x;
+						switch ((index + thread_index) % 3)
+						{
+						case 0:
+							z.store(inc(desired), desired.get(), order);
+							break;
+						case 1:
+						{
+							const auto [ctrl, value] = z.exchange(inc(desired), desired.get(), order);
+							policy::decrement(ctrl);
+							break;
+						}
+						default:
+						{
+							const auto [ctrl, value] = z.load(order);
+							ASSERT_TRUE((ctrl == x_ctrl && value == x.get()) || (ctrl == y_ctrl && value == y.get()));
+							policy::decrement(ctrl);
+							break;
+						}
+						}
+					}
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+			EXPECT_EQ(x.use_count() + y.use_count(), 3u);
+		}
+		EXPECT_EQ(x.use_count(), 1u);
+		EXPECT_EQ(y.use_count(), 1u);
+	}
+} // anonymous namespace
+
+TEST(sh_atomic_wide_shared_ptr, atomic_control_and_value)
+{
+	test_atomic_control_and_value<sh::pointer::atomic_control_and_value<sh::pointer::shared_policy>>();
+}
+#if SH_POINTER_DWCAS
+TEST(sh_atomic_wide_shared_ptr, atomic_dwcas_control_and_value)
+{
+	test_atomic_control_and_value<sh::pointer::atomic_dwcas_control_and_value<sh::pointer::shared_policy>>();
+}
+#endif // SH_POINTER_DWCAS
 
 TEST(sh_atomic_wide_weak_ptr, atomic_wide_weak_ptr_ctor_default)
 {
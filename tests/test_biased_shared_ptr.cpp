@@ -0,0 +1,222 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/atomic_shared_ptr.hpp>
+#include <sh/shared_ptr.hpp>
+#include <sh/wide_shared_ptr.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct destruct_counter final
+	{
+		explicit destruct_counter(std::atomic<int>& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_counter()
+		{
+			m_destructed.fetch_add(1);
+		}
+		std::atomic<int>& m_destructed;
+	};
+} // anonymous namespace
+
+TEST(sh_biased_shared_ptr, make_shared_biased)
+{
+	const sh::shared_ptr<int> x = sh::make_shared_biased<int>(123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(*x, 123);
+	EXPECT_EQ(x.use_count(), 1u);
+	{
+		const sh::shared_ptr<int> y = x;
+		EXPECT_EQ(x.use_count(), 2u);
+		const sh::shared_ptr<const int> z = y;
+		EXPECT_EQ(x.use_count(), 3u);
+	}
+	EXPECT_EQ(x.use_count(), 1u);
+}
+TEST(sh_biased_shared_ptr, allocate_shared_biased)
+{
+	const sh::shared_ptr<int> x = sh::allocate_shared_biased<int>(std::allocator<int>{}, 123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(*x, 123);
+	EXPECT_EQ(x.use_count(), 1u);
+}
+TEST(sh_biased_shared_ptr, destruct)
+{
+	std::atomic<int> destructed{ 0 };
+	{
+		sh::shared_ptr<destruct_counter> x = sh::make_shared_biased<destruct_counter>(destructed);
+		sh::shared_ptr<destruct_counter> y = x;
+		x.reset();
+		EXPECT_EQ(destructed, 0);
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_biased_shared_ptr, weak_ptr)
+{
+	sh::shared_ptr<int> x = sh::make_shared_biased<int>(123);
+	const sh::weak_ptr<int> weak{ x };
+	EXPECT_FALSE(weak.expired());
+	EXPECT_EQ(weak.use_count(), 1u);
+	{
+		const sh::shared_ptr<int> locked = weak.lock();
+		ASSERT_TRUE(bool(locked));
+		EXPECT_EQ(*locked, 123);
+		EXPECT_EQ(x.use_count(), 2u);
+	}
+	x.reset();
+	EXPECT_TRUE(weak.expired());
+	EXPECT_FALSE(bool(weak.lock()));
+}
+TEST(sh_biased_shared_ptr, wide_shared_ptr)
+{
+	struct base
+	{
+		virtual ~base() = default;
+		int m_value{ 123 };
+	};
+	struct derived final : virtual base
+	{
+		explicit derived(std::atomic<int>& destructed) noexcept
+			: m_counter{ destructed }
+		{ }
+		destruct_counter m_counter;
+	};
+
+	std::atomic<int> destructed{ 0 };
+	{
+		sh::wide_shared_ptr<derived> x{ sh::make_shared_biased<derived>(destructed) };
+		const sh::wide_weak_ptr<derived> weak_derived{ x };
+		// Conversion to a virtual base locks, then demotes to weak:
+		const sh::wide_weak_ptr<base> weak_base{ weak_derived };
+		EXPECT_EQ(x.use_count(), 1u);
+		EXPECT_EQ(weak_base.lock()->m_value, 123);
+		x.reset();
+		EXPECT_EQ(destructed, 1);
+		EXPECT_TRUE(weak_base.expired());
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_biased_shared_ptr, atomic_shared_ptr)
+{
+	std::atomic<int> destructed{ 0 };
+	{
+		sh::atomic_shared_ptr<destruct_counter> x{ sh::make_shared_biased<destruct_counter>(destructed) };
+		const sh::shared_ptr<destruct_counter> loaded = x.load();
+		EXPECT_EQ(loaded.use_count(), 2u);
+		x.store(nullptr);
+		EXPECT_EQ(loaded.use_count(), 1u);
+		EXPECT_EQ(destructed, 0);
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_biased_shared_ptr, released_by_other_thread)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::shared_ptr<destruct_counter> x = sh::make_shared_biased<destruct_counter>(destructed);
+	sh::shared_ptr<destruct_counter> y = x;
+	std::thread other([moved = std::move(y)]() mutable
+	{
+		// Releases a reference counted by the owning thread:
+		moved.reset();
+	});
+	other.join();
+	EXPECT_EQ(destructed, 0);
+	EXPECT_EQ(x.use_count(), 1u);
+	x.reset();
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_biased_shared_ptr, last_released_by_other_thread)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::shared_ptr<destruct_counter> x = sh::make_shared_biased<destruct_counter>(destructed);
+	std::thread other([moved = std::move(x)]() mutable
+	{
+		moved.reset();
+	});
+	other.join();
+#if SH_POINTER_BIASED_COUNT
+	// Destruction awaits the owning thread merging:
+	sh::pointer::bias_owner::merge();
+#endif // SH_POINTER_BIASED_COUNT
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_biased_shared_ptr, owner_exits)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::shared_ptr<destruct_counter> x;
+	std::thread owner([&x, &destructed]()
+	{
+		x = sh::make_shared_biased<destruct_counter>(destructed);
+		const sh::shared_ptr<destruct_counter> copy = x;
+	});
+	owner.join();
+	EXPECT_EQ(x.use_count(), 1u);
+	EXPECT_EQ(destructed, 0);
+	x.reset();
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_biased_shared_ptr, concurrent)
+{
+	constexpr int thread_count = 4;
+	constexpr int iterations = 10000;
+	std::atomic<int> destructed{ 0 };
+	{
+		const sh::shared_ptr<destruct_counter> x = sh::make_shared_biased<destruct_counter>(destructed);
+		std::vector<sh::shared_ptr<destruct_counter>> copies(thread_count, x);
+		std::vector<std::thread> threads;
+		for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+		{
+			threads.emplace_back([&copies, thread_index]()
+			{
+				sh::shared_ptr<destruct_counter> mine = std::move(copies[thread_index]);
+				for (int index = 0; index < iterations; ++index)
+				{
+					const sh::shared_ptr<destruct_counter> copy = mine;
+					const sh::weak_ptr<destruct_counter> weak{ copy };
+					ASSERT_TRUE(bool(weak.lock()));
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		EXPECT_EQ(x.use_count(), 1u);
+		EXPECT_EQ(destructed, 0);
+	}
+	EXPECT_EQ(destructed, 1);
+}
@@ -0,0 +1,113 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/shared_ptr.hpp>
+#include <sh/wide_shared_ptr.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	template <int N>
+	struct tagged final
+	{
+		explicit tagged(int& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~tagged()
+		{
+			m_destructed += N;
+		}
+		int& m_destructed;
+	};
+} // anonymous namespace
+
+TEST(sh_compact_control, layout)
+{
+#if SH_POINTER_COMPACT_CONTROL
+	EXPECT_EQ(alignof(std::uint64_t), sh::pointer::max_alignment);
+	EXPECT_EQ(sizeof(std::uint64_t), sizeof(sh::pointer::convertible_control));
+#else // !SH_POINTER_COMPACT_CONTROL
+	EXPECT_EQ(0u, sizeof(sh::pointer::convertible_control) % sh::pointer::max_alignment);
+#endif // !SH_POINTER_COMPACT_CONTROL
+}
+TEST(sh_compact_control, distinct_operations)
+{
+	// Each type's control blocks find their own operations rather than those of another type:
+	int destructed{ 0 };
+	{
+		const sh::shared_ptr<tagged<1>> x = sh::make_shared<tagged<1>>(destructed);
+		const sh::shared_ptr<tagged<10>> y = sh::allocate_shared<tagged<10>>(std::allocator<tagged<10>>{}, destructed);
+		const sh::wide_shared_ptr<tagged<100>> z{ new tagged<100>(destructed) };
+		EXPECT_EQ(0, destructed);
+	}
+	EXPECT_EQ(111, destructed);
+}
+TEST(sh_compact_control, counts)
+{
+	const sh::shared_ptr<int> x = sh::make_shared<int>(5);
+	std::vector<sh::shared_ptr<int>> copies(1000, x);
+	std::vector<sh::weak_ptr<int>> weaks(1000, x);
+	EXPECT_EQ(1001, x.use_count());
+	copies.clear();
+	EXPECT_EQ(1, x.use_count());
+	EXPECT_FALSE(weaks.back().expired());
+	EXPECT_EQ(5, *weaks.back().lock());
+}
+TEST(sh_compact_control, weak_outlives_value)
+{
+	int destructed{ 0 };
+	sh::weak_ptr<tagged<1>> weak;
+	{
+		const sh::shared_ptr<tagged<1>> x = sh::make_shared<tagged<1>>(destructed);
+		weak = x;
+	}
+	EXPECT_EQ(1, destructed);
+	EXPECT_TRUE(weak.expired());
+	EXPECT_EQ(nullptr, weak.lock());
+	weak.reset();
+}
+TEST(sh_compact_control, deleter)
+{
+	int deleted{ 0 };
+	const auto deleter = [&deleted](int* const value) { ++deleted; delete value; };
+	{
+		const sh::wide_shared_ptr<int> x{ new int{ 3 }, deleter };
+		EXPECT_NE(nullptr, sh::get_deleter<decltype(deleter)>(x));
+		const sh::wide_shared_ptr<int> y{ x };
+		EXPECT_EQ(2, y.use_count());
+	}
+	EXPECT_EQ(1, deleted);
+}
@@ -0,0 +1,115 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/shared_ptr.hpp>
+#include <vector>
+
+#if SH_POINTER_DEBUG_SHARED_PTR
+namespace
+{
+	/**	Sets a sample rate for the duration of a test, restoring the previous rate afterward.
+	 */
+	class scoped_sample_rate final
+	{
+	public:
+		explicit scoped_sample_rate(const std::size_t rate) noexcept
+			: m_previous{ sh::pointer::control_validation::sample_rate() }
+		{
+			sh::pointer::control_validation::set_sample_rate(rate);
+		}
+		~scoped_sample_rate()
+		{
+			sh::pointer::control_validation::set_sample_rate(m_previous);
+		}
+	private:
+		std::size_t m_previous;
+	};
+} // anonymous namespace
+
+TEST(sh_control_validation, sample_all)
+{
+	const scoped_sample_rate rate{ 1 };
+	const std::size_t before{ sh::pointer::control_validation::size() };
+	{
+		sh::shared_ptr<int> x = sh::make_shared<int>(123);
+		EXPECT_EQ(before + 1, sh::pointer::control_validation::size());
+		sh::shared_ptr<int[]> y = sh::make_shared<int[]>(4);
+		EXPECT_EQ(before + 2, sh::pointer::control_validation::size());
+		y[3] = *x;
+		EXPECT_EQ(123, y[3]);
+	}
+	EXPECT_EQ(before, sh::pointer::control_validation::size());
+}
+TEST(sh_control_validation, sample_none)
+{
+	const scoped_sample_rate rate{ 0 };
+	const std::size_t before{ sh::pointer::control_validation::size() };
+	{
+		sh::shared_ptr<int> x = sh::make_shared<int>(123);
+		sh::shared_ptr<int[]> y = sh::make_shared<int[]>(4);
+		EXPECT_EQ(before, sh::pointer::control_validation::size());
+		y[3] = *x;
+		EXPECT_EQ(123, y[3]);
+	}
+	EXPECT_EQ(before, sh::pointer::control_validation::size());
+}
+TEST(sh_control_validation, sample_some)
+{
+	const scoped_sample_rate rate{ 4 };
+	const std::size_t before{ sh::pointer::control_validation::size() };
+	{
+		std::vector<sh::shared_ptr<int>> values;
+		for (int i = 0; i < 8; ++i)
+		{
+			values.push_back(sh::make_shared<int>(i));
+		}
+		EXPECT_EQ(before + 2, sh::pointer::control_validation::size());
+	}
+	EXPECT_EQ(before, sh::pointer::control_validation::size());
+}
+TEST(sh_control_validation, weak_outlives_shared)
+{
+	const scoped_sample_rate rate{ 1 };
+	const std::size_t before{ sh::pointer::control_validation::size() };
+	sh::weak_ptr<int> weak;
+	{
+		sh::shared_ptr<int> x = sh::make_shared<int>(123);
+		weak = x;
+	}
+	// The state remains until the control block is deallocated.
+	EXPECT_TRUE(weak.expired());
+	EXPECT_EQ(before + 1, sh::pointer::control_validation::size());
+	weak.reset();
+	EXPECT_EQ(before, sh::pointer::control_validation::size());
+}
+#endif // SH_POINTER_DEBUG_SHARED_PTR
@@ -0,0 +1,182 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/deferred_shared.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct destruct_recorder final
+	{
+		explicit destruct_recorder(std::atomic<int>& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_recorder()
+		{
+			m_destructed.fetch_add(1);
+		}
+		std::atomic<int>& m_destructed;
+	};
+
+	struct order_recorder final
+	{
+		order_recorder(std::vector<int>& order, const int value) noexcept
+			: m_order{ order }
+			, m_value{ value }
+		{ }
+		~order_recorder()
+		{
+			m_order.push_back(m_value);
+		}
+		std::vector<int>& m_order;
+		const int m_value;
+	};
+} // anonymous namespace
+
+TEST(sh_deferred_shared, pump)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::deferred_reclaimer reclaimer;
+	sh::shared_ptr<destruct_recorder> x = sh::allocate_shared_deferred<destruct_recorder>(reclaimer, std::allocator<destruct_recorder>{}, destructed);
+	sh::shared_ptr<destruct_recorder> y = x;
+	EXPECT_TRUE(reclaimer.empty());
+	x.reset();
+	EXPECT_TRUE(reclaimer.empty());
+	EXPECT_EQ(0u, reclaimer.pump());
+
+	const sh::weak_ptr<destruct_recorder> z = y;
+	y.reset();
+	EXPECT_FALSE(reclaimer.empty());
+	EXPECT_EQ(0, destructed.load());
+	EXPECT_TRUE(z.expired());
+
+	EXPECT_EQ(1u, reclaimer.pump());
+	EXPECT_EQ(1, destructed.load());
+	EXPECT_TRUE(reclaimer.empty());
+}
+TEST(sh_deferred_shared, weak_outlives_pump)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::deferred_reclaimer reclaimer;
+	sh::shared_ptr<destruct_recorder> x = sh::allocate_shared_deferred<destruct_recorder>(reclaimer, std::allocator<destruct_recorder>{}, destructed);
+	sh::weak_ptr<destruct_recorder> y = x;
+	x.reset();
+	EXPECT_EQ(1u, reclaimer.pump());
+	EXPECT_EQ(1, destructed.load());
+	EXPECT_EQ(nullptr, y.lock());
+	y.reset();
+}
+TEST(sh_deferred_shared, weak_released_before_pump)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::deferred_reclaimer reclaimer;
+	sh::shared_ptr<destruct_recorder> x = sh::allocate_shared_deferred<destruct_recorder>(reclaimer, std::allocator<destruct_recorder>{}, destructed);
+	sh::weak_ptr<destruct_recorder> y = x;
+	x.reset();
+	y.reset();
+	EXPECT_EQ(0, destructed.load());
+	EXPECT_EQ(1u, reclaimer.pump());
+	EXPECT_EQ(1, destructed.load());
+}
+TEST(sh_deferred_shared, order)
+{
+	std::vector<int> order;
+	{
+		sh::deferred_reclaimer reclaimer;
+		std::vector<sh::shared_ptr<order_recorder>> values;
+		for (int index = 0; index < 5; ++index)
+		{
+			values.push_back(sh::allocate_shared_deferred<order_recorder>(reclaimer, std::allocator<order_recorder>{}, order, index));
+		}
+		values.clear();
+		EXPECT_TRUE(order.empty());
+		// Destruction of the reclaimer pumps what remains.
+	}
+	EXPECT_EQ((std::vector<int>{ 0, 1, 2, 3, 4 }), order);
+}
+TEST(sh_deferred_shared, reclaim_thread)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::deferred_reclaimer reclaimer;
+	{
+		const sh::deferred_reclaim_thread background{ reclaimer };
+		sh::shared_ptr<destruct_recorder> x = sh::allocate_shared_deferred<destruct_recorder>(reclaimer, std::allocator<destruct_recorder>{}, destructed);
+		x.reset();
+		while (destructed.load() == 0)
+		{
+			std::this_thread::yield();
+		}
+		for (int index = 0; index < 100; ++index)
+		{
+			sh::allocate_shared_deferred<destruct_recorder>(reclaimer, std::allocator<destruct_recorder>{}, destructed);
+		}
+	}
+	EXPECT_EQ(101, destructed.load());
+	EXPECT_TRUE(reclaimer.empty());
+}
+TEST(sh_deferred_shared, reclaim_thread_stops_while_pumped_elsewhere)
+{
+	sh::deferred_reclaimer reclaimer;
+	std::atomic<bool> stop{ false };
+	std::thread pumper{ [&]()
+	{
+		while (false == stop.load())
+		{
+			reclaimer.pump();
+		}
+	} };
+	for (int index = 0; index < 20; ++index)
+	{
+		const sh::deferred_reclaim_thread background{ reclaimer };
+		// Let the background thread block in wait, so that only its destructor may wake it:
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	stop.store(true);
+	pumper.join();
+}
+TEST(sh_deferred_shared, make_shared_deferred)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::shared_ptr<destruct_recorder> x = sh::make_shared_deferred<destruct_recorder>(destructed);
+	x.reset();
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{ 10 };
+	while (destructed.load() == 0 && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::yield();
+	}
+	EXPECT_EQ(1, destructed.load());
+}
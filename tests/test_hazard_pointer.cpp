@@ -0,0 +1,274 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/atomic_shared_ptr.hpp>
+#include <sh/hazard_pointer.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using sh::atomic_shared_ptr;
+using sh::hazard_guard;
+using sh::pointer::hazard_domain;
+
+namespace
+{
+	struct destruct_flag final
+	{
+		explicit destruct_flag(bool& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_flag()
+		{
+			m_destructed = true;
+		}
+		bool& m_destructed;
+	};
+	/**	Protects a value within a thread_local's destructor, until released by another thread.
+	 */
+	struct protect_at_exit final
+	{
+		~protect_at_exit()
+		{
+			const hazard_guard<destruct_flag> guard = hazard_domain::global().protect(*m_source);
+			m_protected->store(true);
+			while (m_release->load() == false)
+			{
+				std::this_thread::yield();
+			}
+		}
+		const atomic_shared_ptr<destruct_flag>* m_source{ nullptr };
+		std::atomic<bool>* m_protected{ nullptr };
+		const std::atomic<bool>* m_release{ nullptr };
+	};
+} // anonymous namespace
+
+TEST(sh_hazard_pointer, protect_empty)
+{
+	const atomic_shared_ptr<int> x;
+	const hazard_guard<int> guard = hazard_domain::global().protect(x);
+	EXPECT_FALSE(bool(guard));
+	EXPECT_EQ(guard.get(), nullptr);
+}
+TEST(sh_hazard_pointer, protect)
+{
+	const sh::shared_ptr<int> value = sh::make_shared<int>(123);
+	const atomic_shared_ptr<int> x{ value };
+	const hazard_guard<int> guard = hazard_domain::global().protect(x);
+	ASSERT_TRUE(bool(guard));
+	EXPECT_EQ(guard.get(), value.get());
+	EXPECT_EQ(*guard, 123);
+	// Borrowing doesn't touch the reference count:
+	EXPECT_EQ(value.use_count(), 2u);
+}
+TEST(sh_hazard_pointer, protect_const)
+{
+	const atomic_shared_ptr<const int> x{ sh::make_shared<int>(123) };
+	const hazard_guard<const int> guard = hazard_domain::global().protect(x);
+	ASSERT_TRUE(bool(guard));
+	EXPECT_EQ(*guard, 123);
+}
+TEST(sh_hazard_pointer, move)
+{
+	const atomic_shared_ptr<int> x{ sh::make_shared<int>(123) };
+	hazard_guard<int> a = hazard_domain::global().protect(x);
+	hazard_guard<int> b{ std::move(a) };
+	EXPECT_FALSE(bool(a));
+	ASSERT_TRUE(bool(b));
+	EXPECT_EQ(*b, 123);
+	a = std::move(b);
+	EXPECT_FALSE(bool(b));
+	ASSERT_TRUE(bool(a));
+	EXPECT_EQ(*a, 123);
+	a.reset();
+	EXPECT_FALSE(bool(a));
+}
+TEST(sh_hazard_pointer, store_defers_destruction)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	hazard_guard<destruct_flag> guard = hazard_domain::global().protect(x);
+	ASSERT_TRUE(bool(guard));
+	x.store(nullptr);
+	EXPECT_FALSE(destructed);
+	EXPECT_EQ(&guard->m_destructed, &destructed);
+	guard.reset();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_hazard_pointer, exchange_defers_destruction)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	hazard_guard<destruct_flag> guard = hazard_domain::global().protect(x);
+	{
+		sh::shared_ptr<destruct_flag> exchanged = x.exchange(nullptr);
+		EXPECT_EQ(exchanged.get(), guard.get());
+	}
+	EXPECT_FALSE(destructed);
+	guard.reset();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_hazard_pointer, compare_exchange_defers_destruction)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	hazard_guard<destruct_flag> guard = hazard_domain::global().protect(x);
+	{
+		sh::shared_ptr<destruct_flag> expected = x.load();
+		ASSERT_TRUE(x.compare_exchange_strong(expected, nullptr));
+	}
+	EXPECT_FALSE(destructed);
+	guard.reset();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_hazard_pointer, destructor_defers_destruction)
+{
+	bool destructed = false;
+	hazard_guard<destruct_flag> guard;
+	{
+		const atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+		guard = hazard_domain::global().protect(x);
+	}
+	EXPECT_FALSE(destructed);
+	guard.reset();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_hazard_pointer, unprotected_destruction)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	hazard_domain::global().protect(x).reset();
+	x.store(nullptr);
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_hazard_pointer, reclaim_reentrant)
+{
+	struct store_on_destruct final
+	{
+		explicit store_on_destruct(atomic_shared_ptr<destruct_flag>& target) noexcept
+			: m_target{ target }
+		{ }
+		~store_on_destruct()
+		{
+			m_target.store(nullptr);
+		}
+		atomic_shared_ptr<destruct_flag>& m_target;
+	};
+
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> inner{ sh::make_shared<destruct_flag>(destructed) };
+	atomic_shared_ptr<store_on_destruct> outer{ sh::make_shared<store_on_destruct>(inner) };
+	hazard_guard<destruct_flag> inner_guard = hazard_domain::global().protect(inner);
+	hazard_guard<store_on_destruct> outer_guard = hazard_domain::global().protect(outer);
+	outer.store(nullptr);
+	// Reclaiming outer's value replaces inner's, which is deferred in turn:
+	outer_guard.reset();
+	EXPECT_FALSE(destructed);
+	EXPECT_FALSE(bool(inner.load()));
+	inner_guard.reset();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_hazard_pointer, protect_during_thread_exit)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	const atomic_shared_ptr<int> y{ sh::make_shared<int>(123) };
+	std::atomic<bool> protected_at_exit{ false };
+	std::atomic<bool> release{ false };
+	std::thread exiting{ [&]()
+	{
+		// Constructed before the thread caches a hazard record, so destroyed after the cache releases it:
+		thread_local protect_at_exit late;
+		late.m_source = &x;
+		late.m_protected = &protected_at_exit;
+		late.m_release = &release;
+		(void)hazard_domain::global().protect(y);
+	} };
+	while (protected_at_exit.load() == false)
+	{
+		std::this_thread::yield();
+	}
+	// Claim every record not in use, which mustn't include that protecting x:
+	std::thread other{ [&y]()
+	{
+		std::vector<hazard_guard<int>> guards;
+		for (int index = 0; index < 256; ++index)
+		{
+			guards.push_back(hazard_domain::global().protect(y));
+		}
+	} };
+	other.join();
+	x.store(nullptr);
+	EXPECT_FALSE(destructed);
+	release.store(true);
+	exiting.join();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_hazard_pointer, concurrent)
+{
+	constexpr int thread_count = 4;
+	static constexpr int iterations = 10000;
+	atomic_shared_ptr<int> z{ sh::make_shared<int>(0) };
+
+	std::vector<std::thread> threads;
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([&z, thread_index]()
+		{
+			for (int index = 0; index < iterations; ++index)
+			{
+				switch ((index + thread_index) % 3)
+				{
+				case 0:
+					z.store(sh::make_shared<int>(index));
+					break;
+				case 1:
+					(void)z.exchange(sh::make_shared<int>(index));
+					break;
+				default:
+				{
+					const hazard_guard<int> guard = hazard_domain::global().protect(z);
+					ASSERT_TRUE(bool(guard));
+					ASSERT_GE(*guard, 0);
+					ASSERT_LT(*guard, iterations);
+					break;
+				}
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
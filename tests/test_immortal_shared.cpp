@@ -0,0 +1,167 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/atomic_shared_ptr.hpp>
+#include <sh/shared_ptr.hpp>
+#include <sh/wide_shared_ptr.hpp>
+#include <cstddef>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	/**	Immortal allocations are never deallocated, so allocate them from static storage to keep leak checkers quiet.
+	 */
+	std::pmr::polymorphic_allocator<std::byte> immortal_allocator()
+	{
+		alignas(std::max_align_t) static std::byte buffer[4096];
+		static std::pmr::monotonic_buffer_resource resource{ buffer, sizeof(buffer), std::pmr::null_memory_resource() };
+		return &resource;
+	}
+
+	/**	Expect the use_count of a pointer to an immortal value, reported as immortal_use_count only if
+	 *	SH_POINTER_SPECIAL_COUNT. Otherwise, the never released reference is counted along with those held.
+	 */
+	template <typename Pointer>
+	void expect_immortal_use_count(const Pointer& pointer)
+	{
+#if SH_POINTER_SPECIAL_COUNT
+		EXPECT_EQ(pointer.use_count(), sh::pointer::immortal_use_count);
+#else // !SH_POINTER_SPECIAL_COUNT
+		EXPECT_GT(pointer.use_count(), 1u);
+#endif // !SH_POINTER_SPECIAL_COUNT
+	}
+
+	struct destruct_counter final
+	{
+		explicit destruct_counter(int& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_counter()
+		{
+			++m_destructed;
+		}
+		int& m_destructed;
+	};
+} // anonymous namespace
+
+TEST(sh_immortal_shared, make_immortal_shared)
+{
+	static const sh::shared_ptr<int> x = sh::make_immortal_shared<int>(123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(*x, 123);
+	expect_immortal_use_count(x);
+	{
+		const sh::shared_ptr<int> y = x;
+		const sh::shared_ptr<const int> z = y;
+		EXPECT_EQ(*z, 123);
+		expect_immortal_use_count(x);
+	}
+	expect_immortal_use_count(x);
+}
+TEST(sh_immortal_shared, never_destructed)
+{
+	int destructed{ 0 };
+	{
+		sh::shared_ptr<destruct_counter> x = sh::allocate_immortal_shared<destruct_counter>(immortal_allocator(), destructed);
+		sh::shared_ptr<destruct_counter> y = x;
+		x.reset();
+		y.reset();
+	}
+	EXPECT_EQ(destructed, 0);
+}
+TEST(sh_immortal_shared, weak_ptr)
+{
+	sh::shared_ptr<int> x = sh::allocate_immortal_shared<int>(immortal_allocator(), 123);
+	const sh::weak_ptr<int> weak{ x };
+	expect_immortal_use_count(weak);
+	x.reset();
+	// Always locks, even with no other references:
+	EXPECT_FALSE(weak.expired());
+	const sh::shared_ptr<int> locked = weak.lock();
+	ASSERT_TRUE(bool(locked));
+	EXPECT_EQ(*locked, 123);
+	expect_immortal_use_count(locked);
+}
+TEST(sh_immortal_shared, wide_and_atomic)
+{
+	const sh::shared_ptr<int> x = sh::allocate_immortal_shared<int>(immortal_allocator(), 123);
+	{
+		const sh::wide_shared_ptr<int> wide{ x };
+		const sh::wide_weak_ptr<int> weak{ wide };
+		expect_immortal_use_count(wide);
+		EXPECT_EQ(*weak.lock(), 123);
+	}
+	std::atomic<sh::shared_ptr<int>> atomic{ x };
+	EXPECT_EQ(*atomic.load(), 123);
+	atomic.store(sh::shared_ptr<int>{});
+	EXPECT_EQ(*x, 123);
+	expect_immortal_use_count(x);
+}
+TEST(sh_immortal_shared, shared_from_this)
+{
+	struct value final : sh::enable_shared_from_this<value>
+	{
+		int m_value{ 123 };
+	};
+	const sh::shared_ptr<value> x = sh::allocate_immortal_shared<value>(immortal_allocator());
+	const sh::wide_shared_ptr<value> y = x->shared_from_this();
+	EXPECT_EQ(x.get(), y.get());
+	expect_immortal_use_count(y);
+}
+TEST(sh_immortal_shared, threads)
+{
+	const sh::shared_ptr<int> x = sh::allocate_immortal_shared<int>(immortal_allocator(), 123);
+	std::vector<std::thread> threads;
+	for (int thread_index = 0; thread_index < 4; ++thread_index)
+	{
+		threads.emplace_back([&x]()
+		{
+			for (int i = 0; i < 10'000; ++i)
+			{
+				sh::shared_ptr<int> copy = x;
+				sh::weak_ptr<int> weak{ copy };
+				copy.reset();
+				copy = weak.lock();
+				ASSERT_TRUE(bool(copy));
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	EXPECT_EQ(*x, 123);
+	expect_immortal_use_count(x);
+}
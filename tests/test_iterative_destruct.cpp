@@ -0,0 +1,129 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/shared_ptr.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	struct node final
+	{
+		explicit node(sh::shared_ptr<node> next, std::vector<int>* const destructed = nullptr, const int id = 0) noexcept
+			: m_next{ std::move(next) }
+			, m_destructed{ destructed }
+			, m_id{ id }
+		{ }
+		~node()
+		{
+			if (m_destructed != nullptr)
+			{
+				m_destructed->push_back(m_id);
+			}
+		}
+		sh::shared_ptr<node> m_next;
+		std::vector<int>* m_destructed;
+		int m_id;
+	};
+
+	sh::shared_ptr<node> make_chain(const std::size_t length, std::vector<int>* const destructed = nullptr)
+	{
+		sh::shared_ptr<node> head;
+		for (std::size_t i = 0; i < length; ++i)
+		{
+			head = sh::make_shared<node>(std::move(head), destructed, int(i));
+		}
+		return head;
+	}
+} // anonymous namespace
+
+TEST(sh_iterative_destruct, chain)
+{
+	std::vector<int> destructed;
+	sh::shared_ptr<node> head = make_chain(4, &destructed);
+	head.reset();
+	// Values are destructed from the head of the chain (constructed last) to its tail:
+	EXPECT_EQ(destructed, (std::vector<int>{ 3, 2, 1, 0 }));
+}
+TEST(sh_iterative_destruct, shared_tail)
+{
+	std::vector<int> destructed;
+	sh::shared_ptr<node> head = make_chain(4, &destructed);
+	const sh::shared_ptr<node> tail = head->m_next->m_next;
+	head.reset();
+	EXPECT_EQ(destructed, (std::vector<int>{ 3, 2 }));
+	EXPECT_EQ(tail.use_count(), 1u);
+	EXPECT_EQ(tail->m_id, 1);
+	EXPECT_EQ(tail->m_next->m_id, 0);
+}
+TEST(sh_iterative_destruct, weak_references)
+{
+	std::vector<int> destructed;
+	sh::shared_ptr<node> head = make_chain(4, &destructed);
+	const sh::weak_ptr<node> weak_head{ head };
+	const sh::weak_ptr<node> weak_middle{ head->m_next->m_next };
+	head.reset();
+	EXPECT_EQ(destructed, (std::vector<int>{ 3, 2, 1, 0 }));
+	EXPECT_TRUE(weak_head.expired());
+	EXPECT_TRUE(weak_middle.expired());
+}
+TEST(sh_iterative_destruct, reassign_during_destruct)
+{
+	struct reassigner final
+	{
+		~reassigner()
+		{
+			// Release & create references while the releasing thread may be draining:
+			m_next = sh::make_shared<node>(sh::shared_ptr<node>{});
+			m_next.reset();
+		}
+		sh::shared_ptr<node> m_next;
+	};
+	sh::shared_ptr<reassigner> x = sh::make_shared<reassigner>();
+	x->m_next = make_chain(8);
+	x.reset();
+	const sh::shared_ptr<node> after = make_chain(2);
+	EXPECT_EQ(after.use_count(), 1u);
+}
+#if SH_POINTER_ITERATIVE_DESTRUCT
+TEST(sh_iterative_destruct, long_chain)
+{
+	// Recursive destruction of this many nodes would likely overflow the stack:
+	constexpr std::size_t length = 1'000'000;
+	sh::shared_ptr<node> head = make_chain(length);
+	ASSERT_TRUE(bool(head));
+	head.reset();
+	EXPECT_FALSE(bool(head));
+}
+#endif // SH_POINTER_ITERATIVE_DESTRUCT
@@ -0,0 +1,193 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <sh/local_shared_ptr.hpp>
+#include <unordered_set>
+
+namespace
+{
+	struct destruct_counter final
+	{
+		explicit destruct_counter(int& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_counter()
+		{
+			++m_destructed;
+		}
+		int& m_destructed;
+	};
+
+	struct base
+	{
+		int m_value{ 1 };
+	};
+	struct derived final : base
+	{ };
+} // anonymous namespace
+
+TEST(sh_local_shared_ptr, size)
+{
+	EXPECT_EQ(sizeof(sh::local_shared_ptr<int>), sizeof(int*));
+	EXPECT_EQ(sizeof(sh::local_weak_ptr<int>), sizeof(int*));
+}
+TEST(sh_local_shared_ptr, make_local_shared)
+{
+	const sh::local_shared_ptr<int> x = sh::make_local_shared<int>(123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(*x, 123);
+	EXPECT_EQ(x.use_count(), 1u);
+	{
+		const sh::local_shared_ptr<int> y = x;
+		EXPECT_EQ(x.use_count(), 2u);
+		const sh::local_shared_ptr<const int> z = y;
+		EXPECT_EQ(x.use_count(), 3u);
+		EXPECT_EQ(x, y);
+		EXPECT_EQ(y.get(), z.get());
+	}
+	EXPECT_EQ(x.use_count(), 1u);
+}
+TEST(sh_local_shared_ptr, allocate_local_shared)
+{
+	const sh::local_shared_ptr<int> x = sh::allocate_local_shared<int>(std::allocator<int>{}, 123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(*x, 123);
+	EXPECT_EQ(x.use_count(), 1u);
+}
+TEST(sh_local_shared_ptr, empty)
+{
+	sh::local_shared_ptr<int> x;
+	EXPECT_FALSE(bool(x));
+	EXPECT_EQ(x, nullptr);
+	EXPECT_EQ(x.use_count(), 0u);
+	x = sh::make_local_shared<int>(1);
+	EXPECT_NE(x, nullptr);
+	x = nullptr;
+	EXPECT_EQ(x, nullptr);
+}
+TEST(sh_local_shared_ptr, move)
+{
+	sh::local_shared_ptr<int> x = sh::make_local_shared<int>(123);
+	sh::local_shared_ptr<int> y = std::move(x);
+	EXPECT_EQ(x, nullptr);
+	ASSERT_NE(y, nullptr);
+	EXPECT_EQ(y.use_count(), 1u);
+	x = std::move(y);
+	EXPECT_EQ(y, nullptr);
+	EXPECT_EQ(*x, 123);
+
+	sh::local_shared_ptr<int> z = sh::make_local_shared<int>(456);
+	x.swap(z);
+	EXPECT_EQ(*x, 456);
+	EXPECT_EQ(*z, 123);
+}
+TEST(sh_local_shared_ptr, destruct)
+{
+	int destructed{ 0 };
+	{
+		sh::local_shared_ptr<destruct_counter> x = sh::make_local_shared<destruct_counter>(destructed);
+		sh::local_shared_ptr<destruct_counter> y = x;
+		x.reset();
+		EXPECT_EQ(destructed, 0);
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_local_shared_ptr, conversion)
+{
+	sh::local_shared_ptr<derived> x = sh::make_local_shared<derived>();
+	sh::local_shared_ptr<base> y = x;
+	EXPECT_EQ(y->m_value, 1);
+	EXPECT_EQ(x.use_count(), 2u);
+	sh::local_shared_ptr<base> z = std::move(x);
+	EXPECT_EQ(x, nullptr);
+	EXPECT_EQ(z.use_count(), 2u);
+	y = sh::make_local_shared<derived>();
+	EXPECT_EQ(z.use_count(), 1u);
+}
+TEST(sh_local_shared_ptr, weak)
+{
+	int destructed{ 0 };
+	sh::local_weak_ptr<destruct_counter> weak;
+	EXPECT_TRUE(weak.expired());
+	EXPECT_EQ(weak.lock(), nullptr);
+	{
+		const sh::local_shared_ptr<destruct_counter> x = sh::make_local_shared<destruct_counter>(destructed);
+		weak = x;
+		EXPECT_FALSE(weak.expired());
+		EXPECT_EQ(weak.use_count(), 1u);
+		const sh::local_weak_ptr<destruct_counter> weak_copy = weak;
+		const sh::local_shared_ptr<destruct_counter> locked = weak_copy.lock();
+		EXPECT_EQ(locked, x);
+		EXPECT_EQ(x.use_count(), 2u);
+	}
+	EXPECT_EQ(destructed, 1);
+	EXPECT_TRUE(weak.expired());
+	EXPECT_EQ(weak.use_count(), 0u);
+	EXPECT_EQ(weak.lock(), nullptr);
+	weak.reset();
+	EXPECT_TRUE(weak.expired());
+}
+TEST(sh_local_shared_ptr, weak_outlives_shared)
+{
+	sh::local_weak_ptr<int> weak;
+	{
+		sh::local_shared_ptr<int> x = sh::make_local_shared<int>(1);
+		weak = x;
+		sh::local_weak_ptr<int> other{ x };
+		x.reset();
+		EXPECT_TRUE(other.expired());
+	}
+	EXPECT_TRUE(weak.expired());
+}
+TEST(sh_local_shared_ptr, owner_less_and_hash)
+{
+	const sh::local_shared_ptr<int> x = sh::make_local_shared<int>(1);
+	const sh::local_shared_ptr<int> y = sh::make_local_shared<int>(2);
+	const sh::local_weak_ptr<int> weak_x{ x };
+
+	const sh::owner_less<sh::local_shared_ptr<int>> less{};
+	EXPECT_NE(less(x, y), less(y, x));
+	EXPECT_FALSE(less(x, weak_x));
+	EXPECT_FALSE(less(weak_x, x));
+
+	std::map<sh::local_weak_ptr<int>, int, sh::owner_less<sh::local_weak_ptr<int>>> by_owner;
+	by_owner[weak_x] = 1;
+	by_owner[sh::local_weak_ptr<int>{ y }] = 2;
+	EXPECT_EQ(by_owner.size(), 2u);
+	EXPECT_EQ(by_owner[sh::local_weak_ptr<int>{ x }], 1);
+
+	std::unordered_set<sh::local_shared_ptr<int>> set{ x, y, x };
+	EXPECT_EQ(set.size(), 2u);
+}
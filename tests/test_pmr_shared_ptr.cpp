@@ -0,0 +1,163 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/pmr_shared_ptr.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace
+{
+	class counting_resource final : public std::pmr::memory_resource
+	{
+	public:
+		std::size_t m_allocations{ 0 };
+		std::size_t m_deallocations{ 0 };
+		std::size_t m_last_bytes{ 0 };
+		std::size_t m_last_alignment{ 0 };
+
+	private:
+		void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+		{
+			++m_allocations;
+			m_last_bytes = bytes;
+			m_last_alignment = alignment;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+		void do_deallocate(void* const p, const std::size_t bytes, const std::size_t alignment) override
+		{
+			++m_deallocations;
+			std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+		}
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			return this == &other;
+		}
+	};
+
+	class default_resource_scope final
+	{
+	public:
+		explicit default_resource_scope(std::pmr::memory_resource* const resource) noexcept
+			: m_previous{ std::pmr::set_default_resource(resource) }
+		{ }
+		~default_resource_scope()
+		{
+			std::pmr::set_default_resource(m_previous);
+		}
+
+	private:
+		std::pmr::memory_resource* const m_previous;
+	};
+
+	struct pair_of_pointers final
+	{
+		void* m_first;
+		void* m_second;
+	};
+} // anonymous namespace
+
+TEST(sh_pmr_shared_ptr, allocate_shared)
+{
+	counting_resource resource;
+	{
+		const sh::shared_ptr<int> x = sh::pmr::allocate_shared<int>(&resource, 123);
+		ASSERT_TRUE(bool(x));
+		EXPECT_EQ(123, *x);
+		EXPECT_EQ(1u, resource.m_allocations);
+		EXPECT_EQ(0u, resource.m_deallocations);
+		EXPECT_EQ(sh::pointer::max_alignment, resource.m_last_alignment);
+	}
+	EXPECT_EQ(1u, resource.m_deallocations);
+}
+TEST(sh_pmr_shared_ptr, make_shared)
+{
+	counting_resource resource;
+	{
+		const default_resource_scope scope{ &resource };
+		const sh::shared_ptr<int> x = sh::pmr::make_shared<int>(456);
+		EXPECT_EQ(456, *x);
+		const sh::shared_ptr<int[]> y = sh::pmr::make_shared<int[]>(3, 7);
+		EXPECT_EQ(7, y[2]);
+		const sh::shared_ptr<int[2]> z = sh::pmr::make_shared_for_overwrite<int[2]>();
+		EXPECT_EQ(3u, resource.m_allocations);
+	}
+	EXPECT_EQ(3u, resource.m_deallocations);
+}
+TEST(sh_pmr_shared_ptr, layout)
+{
+	counting_resource resource;
+	constexpr std::size_t control_size = sizeof(sh::pointer::convertible_control);
+
+	// The allocator fits in the tail padding of small values, unless max_alignment is too small to hold both:
+	sh::shared_ptr<int> x = sh::pmr::allocate_shared<int>(&resource);
+	EXPECT_EQ(control_size + (std::max)(sh::pointer::max_alignment, alignof(void*) + sizeof(void*)), resource.m_last_bytes);
+	sh::shared_ptr<pair_of_pointers> y = sh::pmr::allocate_shared<pair_of_pointers>(&resource);
+	EXPECT_EQ(control_size + sizeof(pair_of_pointers) + sh::pointer::max_alignment, resource.m_last_bytes);
+
+	// Elements are rounded up to max_alignment, not the size of the control block & its allocator & count:
+	sh::shared_ptr<char[]> z = sh::pmr::allocate_shared<char[]>(&resource, 1);
+	EXPECT_EQ(0u, resource.m_last_bytes % sh::pointer::max_alignment);
+	EXPECT_LE(resource.m_last_bytes, control_size + 2 * sizeof(void*) + sh::pointer::max_alignment);
+}
+TEST(sh_pmr_shared_ptr, monotonic_buffer_resource)
+{
+	std::pmr::monotonic_buffer_resource resource;
+	std::vector<sh::shared_ptr<int>> values;
+	for (int index = 0; index < 1000; ++index)
+	{
+		values.push_back(sh::pmr::allocate_shared<int>(&resource, index));
+	}
+	const sh::shared_ptr<double[]> array = sh::pmr::allocate_shared<double[]>(&resource, 100, 1.5);
+	for (int index = 0; index < 1000; ++index)
+	{
+		EXPECT_EQ(index, *values[index]);
+	}
+	EXPECT_EQ(1.5, array[99]);
+}
+TEST(sh_pmr_shared_ptr, unsynchronized_pool_resource)
+{
+	std::pmr::unsynchronized_pool_resource resource;
+	std::vector<sh::shared_ptr<int>> values;
+	for (int round = 0; round < 4; ++round)
+	{
+		for (int index = 0; index < 1000; ++index)
+		{
+			values.push_back(sh::pmr::allocate_shared<int>(&resource, index));
+		}
+		const sh::weak_ptr<int> weak = values.front();
+		values.clear();
+		EXPECT_TRUE(weak.expired());
+	}
+}
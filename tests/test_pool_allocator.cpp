@@ -0,0 +1,219 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/pool_allocator.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct alignas(sh::pointer::max_alignment * 4) extended_alignment
+	{
+		int m_value;
+	};
+
+	template <typename T>
+	bool is_aligned(const T* const value) noexcept
+	{
+		return reinterpret_cast<std::uintptr_t>(value) % alignof(T) == 0;
+	}
+
+	/**	Frees a block within a thread_local's destructor, then allocates & frees another.
+	 */
+	struct deallocate_at_exit final
+	{
+		~deallocate_at_exit()
+		{
+			sh::pointer::pool& pool = sh::pointer::pool::global();
+			pool.deallocate(m_block, m_size);
+			pool.deallocate(pool.allocate(m_size), m_size);
+		}
+		void* m_block{ nullptr };
+		std::size_t m_size{ 0 };
+	};
+} // anonymous namespace
+
+TEST(sh_pool_allocator, reuse)
+{
+	sh::pointer::pool_allocator<int> alloc;
+	int* const x = alloc.allocate(1);
+	alloc.deallocate(x, 1);
+	int* const y = alloc.allocate(1);
+	EXPECT_EQ(x, y);
+	alloc.deallocate(y, 1);
+}
+TEST(sh_pool_allocator, size_classes)
+{
+	sh::pointer::pool_allocator<char> alloc;
+	std::vector<char*> blocks;
+	for (std::size_t size = 1; size <= sh::pointer::pool::max_block_size; ++size)
+	{
+		char* const block = alloc.allocate(size);
+		EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(block) % sh::pointer::pool::block_granularity);
+		std::fill(block, block + size, char(size));
+		blocks.push_back(block);
+	}
+	for (std::size_t size = 1; size <= sh::pointer::pool::max_block_size; ++size)
+	{
+		char* const block = blocks[size - 1];
+		EXPECT_TRUE(std::all_of(block, block + size, [size](const char c) { return c == char(size); }));
+		alloc.deallocate(block, size);
+	}
+}
+TEST(sh_pool_allocator, fallback)
+{
+	sh::pointer::pool_allocator<char> alloc;
+	char* const large = alloc.allocate(sh::pointer::pool::max_block_size + 1);
+	alloc.deallocate(large, sh::pointer::pool::max_block_size + 1);
+
+	sh::pointer::pool_allocator<extended_alignment> aligned_alloc;
+	extended_alignment* const aligned = aligned_alloc.allocate(1);
+	EXPECT_TRUE(is_aligned(aligned));
+	aligned_alloc.deallocate(aligned, 1);
+}
+TEST(sh_pool_allocator, make_pooled_shared)
+{
+	sh::shared_ptr<int> x = sh::make_pooled_shared<int>(123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(123, *x);
+	EXPECT_EQ(1u, x.use_count());
+	sh::weak_ptr<int> y{ x };
+	EXPECT_EQ(x.get(), y.lock().get());
+	x.reset();
+	EXPECT_EQ(nullptr, y.lock().get());
+
+	const sh::shared_ptr<extended_alignment> z = sh::make_pooled_shared<extended_alignment>(extended_alignment{ 456 });
+	EXPECT_TRUE(is_aligned(z.get()));
+	EXPECT_EQ(456, z->m_value);
+}
+TEST(sh_pool_allocator, cross_thread_free)
+{
+	static constexpr std::size_t count{ 100 };
+	sh::pointer::pool_allocator<int> alloc;
+	std::vector<int*> blocks;
+	for (std::size_t index = 0; index < count; ++index)
+	{
+		blocks.push_back(alloc.allocate(1));
+	}
+	std::thread{ [&]()
+	{
+		for (int* const block : blocks)
+		{
+			alloc.deallocate(block, 1);
+		}
+		// Thread exit hands back any partial batch.
+	} }.join();
+
+	// Everything handed back is reused before carving new blocks:
+	std::sort(blocks.begin(), blocks.end());
+	std::vector<int*> reused;
+	for (std::size_t index = 0; index < count; ++index)
+	{
+		int* const block = alloc.allocate(1);
+		EXPECT_TRUE(std::binary_search(blocks.begin(), blocks.end(), block));
+		reused.push_back(block);
+	}
+	for (int* const block : reused)
+	{
+		alloc.deallocate(block, 1);
+	}
+}
+TEST(sh_pool_allocator, free_during_thread_exit)
+{
+	static constexpr std::size_t size{ sh::pointer::pool::max_block_size };
+	sh::pointer::pool& pool = sh::pointer::pool::global();
+	void* const block = pool.allocate(size);
+	std::thread{ [&]()
+	{
+		// Constructed before the thread's cache, so destroyed after the cache is released:
+		thread_local deallocate_at_exit late;
+		late.m_block = block;
+		late.m_size = size;
+		pool.deallocate(pool.allocate(size), size);
+	} }.join();
+
+	// The block is handed back rather than left pending in the released cache:
+	std::vector<void*> blocks;
+	while (blocks.size() < 16 && (blocks.empty() || blocks.back() != block))
+	{
+		blocks.push_back(pool.allocate(size));
+	}
+	EXPECT_EQ(block, blocks.back());
+	for (void* const each : blocks)
+	{
+		pool.deallocate(each, size);
+	}
+}
+TEST(sh_pool_allocator, concurrent)
+{
+	static constexpr int iterations{ 2000 };
+	static constexpr int thread_count{ 4 };
+	std::vector<std::vector<sh::shared_ptr<int>>> handoff(thread_count);
+	std::vector<std::thread> threads;
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([&handoff, thread_index]()
+		{
+			for (int index = 0; index < iterations; ++index)
+			{
+				handoff[thread_index].push_back(sh::make_pooled_shared<int>(index));
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	threads.clear();
+	// Release each thread's values from another, with the owning caches
+	// possibly adopted by new threads meanwhile:
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([&handoff, thread_index]()
+		{
+			std::vector<sh::shared_ptr<int>>& values = handoff[(thread_index + 1) % thread_count];
+			for (int index = 0; index < iterations; ++index)
+			{
+				EXPECT_EQ(index, *values[index]);
+				values[index] = sh::make_pooled_shared<int>(-index);
+			}
+			values.clear();
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
@@ -0,0 +1,129 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/shared_ptr.hpp>
+#include <sstream>
+#include <thread>
+
+#if SH_POINTER_PROFILE
+namespace
+{
+	/**	Records every reference count operation for the duration of a test, discarding samples before & after.
+	 */
+	class scoped_profile final
+	{
+	public:
+		scoped_profile() noexcept
+			: m_previous{ sh::pointer::control_profile::sample_rate() }
+		{
+			sh::pointer::control_profile::reset();
+			sh::pointer::control_profile::set_sample_rate(1);
+		}
+		~scoped_profile()
+		{
+			sh::pointer::control_profile::set_sample_rate(m_previous);
+			sh::pointer::control_profile::reset();
+		}
+	private:
+		std::size_t m_previous;
+	};
+
+	struct profiled_value final
+	{
+		int m_value{ 123 };
+	};
+
+	sh::pointer::control_samples samples_of(const void* const ctrl)
+	{
+		for (const auto& [each, samples] : sh::pointer::control_profile::snapshot())
+		{
+			if (each == ctrl)
+			{
+				return samples;
+			}
+		}
+		return {};
+	}
+} // anonymous namespace
+
+TEST(sh_profile, samples)
+{
+	const scoped_profile profile;
+	const sh::shared_ptr<profiled_value> x = sh::make_shared<profiled_value>();
+	const void* const ctrl = sh::pointer::convert_value_to_control(x.get());
+	{
+		const sh::shared_ptr<profiled_value> y = x;
+		const sh::weak_ptr<profiled_value> z = x;
+	}
+	const sh::pointer::control_samples samples = samples_of(ctrl);
+	EXPECT_EQ(4u, samples.m_samples);
+	EXPECT_EQ(0u, samples.m_transfers);
+	EXPECT_NE(nullptr, samples.m_origin);
+}
+TEST(sh_profile, transfers)
+{
+	const scoped_profile profile;
+	const sh::shared_ptr<profiled_value> x = sh::make_shared<profiled_value>();
+	const void* const ctrl = sh::pointer::convert_value_to_control(x.get());
+	std::thread{ [&x]() { const sh::shared_ptr<profiled_value> y = x; } }.join();
+	{
+		const sh::shared_ptr<profiled_value> y = x;
+	}
+	// Copying & releasing on another thread, then copying back on this thread:
+	const sh::pointer::control_samples samples = samples_of(ctrl);
+	EXPECT_EQ(4u, samples.m_samples);
+	EXPECT_EQ(1u, samples.m_transfers);
+}
+TEST(sh_profile, sample_none)
+{
+	const scoped_profile profile;
+	sh::pointer::control_profile::set_sample_rate(0);
+	const sh::shared_ptr<profiled_value> x = sh::make_shared<profiled_value>();
+	{
+		const sh::shared_ptr<profiled_value> y = x;
+	}
+	EXPECT_TRUE(sh::pointer::control_profile::snapshot().empty());
+}
+TEST(sh_profile, report)
+{
+	const scoped_profile profile;
+	const sh::shared_ptr<profiled_value> x = sh::make_shared<profiled_value>();
+	std::thread{ [&x]() { const sh::shared_ptr<profiled_value> y = x; } }.join();
+	std::ostringstream out;
+	sh::pointer::profile_report(out, 1);
+	const std::string report{ out.str() };
+	EXPECT_NE(std::string::npos, report.find("2 samples"));
+	// Types are named by their mangled control block class:
+	EXPECT_NE(std::string::npos, report.find("profiled_value"));
+}
+#endif // SH_POINTER_PROFILE
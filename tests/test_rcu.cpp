@@ -0,0 +1,275 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/atomic_shared_ptr.hpp>
+#include <sh/rcu.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using sh::atomic_shared_ptr;
+using sh::rcu_read_guard;
+using sh::pointer::rcu_domain;
+
+namespace
+{
+	struct destruct_flag final
+	{
+		explicit destruct_flag(bool& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_flag()
+		{
+			m_destructed = true;
+		}
+		bool& m_destructed;
+	};
+	/**	Reads a value within a thread_local's destructor, until released by another thread.
+	 */
+	struct read_at_exit final
+	{
+		~read_at_exit()
+		{
+			const rcu_read_guard guard;
+			(void)guard.load(*m_source);
+			m_step->store(1);
+			m_step->notify_one();
+			m_step->wait(1);
+		}
+		const atomic_shared_ptr<destruct_flag>* m_source{ nullptr };
+		std::atomic<int>* m_step{ nullptr };
+	};
+} // anonymous namespace
+
+TEST(sh_rcu, load_empty)
+{
+	const atomic_shared_ptr<int> x;
+	const rcu_read_guard guard;
+	EXPECT_EQ(guard.load(x), nullptr);
+}
+TEST(sh_rcu, load)
+{
+	const sh::shared_ptr<int> value = sh::make_shared<int>(123);
+	const atomic_shared_ptr<int> x{ value };
+	const atomic_shared_ptr<const int> y{ sh::make_shared<const int>(456) };
+	const rcu_read_guard guard;
+	const int* const loaded = guard.load(x);
+	EXPECT_EQ(loaded, value.get());
+	EXPECT_EQ(*loaded, 123);
+	EXPECT_EQ(*guard.load(y), 456);
+	// Borrowing doesn't touch the reference count:
+	EXPECT_EQ(value.use_count(), 2u);
+}
+TEST(sh_rcu, store_without_readers)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	{
+		const rcu_read_guard guard;
+	}
+	x.store(nullptr);
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_rcu, store_defers_destruction)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	{
+		const rcu_read_guard guard;
+		const destruct_flag* const loaded = guard.load(x);
+		x.store(nullptr);
+		EXPECT_FALSE(destructed);
+		EXPECT_EQ(&loaded->m_destructed, &destructed);
+		EXPECT_EQ(guard.load(x), nullptr);
+	}
+	EXPECT_FALSE(destructed);
+	rcu_domain::global().synchronize();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_rcu, exchange_defers_destruction)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	{
+		const rcu_read_guard guard;
+		const destruct_flag* const loaded = guard.load(x);
+		{
+			const sh::shared_ptr<destruct_flag> exchanged = x.exchange(nullptr);
+			EXPECT_EQ(exchanged.get(), loaded);
+		}
+		EXPECT_FALSE(destructed);
+	}
+	rcu_domain::global().synchronize();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_rcu, nested)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	{
+		const rcu_read_guard outer;
+		const destruct_flag* const loaded = outer.load(x);
+		{
+			const rcu_read_guard inner;
+			EXPECT_EQ(inner.load(x), loaded);
+		}
+		x.store(nullptr);
+		// Still within the outer read section:
+		rcu_domain::global().reclaim();
+		EXPECT_FALSE(destructed);
+	}
+	rcu_domain::global().synchronize();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_rcu, other_thread_reading)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	std::atomic<int> step{ 0 };
+	std::thread reader([&x, &step]()
+	{
+		const rcu_read_guard guard;
+		(void)guard.load(x);
+		step.store(1);
+		step.wait(1);
+	});
+	step.wait(0);
+	x.store(nullptr);
+	rcu_domain::global().reclaim();
+	EXPECT_FALSE(destructed);
+	step.store(2);
+	step.notify_one();
+	reader.join();
+	rcu_domain::global().synchronize();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_rcu, orphaned)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	std::thread writer([&x]()
+	{
+		const rcu_read_guard guard;
+		(void)guard.load(x);
+		// Retired by this thread while it's reading, then orphaned at exit:
+		x.store(nullptr);
+	});
+	writer.join();
+	rcu_domain::global().synchronize();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_rcu, read_during_thread_exit)
+{
+	bool destructed = false;
+	atomic_shared_ptr<destruct_flag> x{ sh::make_shared<destruct_flag>(destructed) };
+	std::atomic<int> step{ 0 };
+	std::thread exiting([&x, &step]()
+	{
+		// Constructed before the thread's record, so destroyed after the record is released:
+		thread_local read_at_exit late;
+		late.m_source = &x;
+		late.m_step = &step;
+		rcu_domain::global().reclaim();
+	});
+	step.wait(0);
+	// Claim every record not in use at once, which mustn't include that of the read section:
+	static constexpr int thread_count{ 64 };
+	std::atomic<int> entered{ 0 };
+	std::vector<std::thread> readers;
+	for (int index = 0; index < thread_count; ++index)
+	{
+		readers.emplace_back([&entered]()
+		{
+			const rcu_read_guard guard;
+			entered.fetch_add(1);
+			while (entered.load() < thread_count)
+			{
+				std::this_thread::yield();
+			}
+		});
+	}
+	for (std::thread& reader : readers)
+	{
+		reader.join();
+	}
+	x.store(nullptr);
+	rcu_domain::global().reclaim();
+	EXPECT_FALSE(destructed);
+	step.store(2);
+	step.notify_one();
+	exiting.join();
+	rcu_domain::global().synchronize();
+	EXPECT_TRUE(destructed);
+}
+TEST(sh_rcu, concurrent)
+{
+	constexpr int thread_count = 4;
+	static constexpr int iterations = 10000;
+	atomic_shared_ptr<int> z{ sh::make_shared<int>(0) };
+
+	std::vector<std::thread> threads;
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([&z, thread_index]()
+		{
+			for (int index = 0; index < iterations; ++index)
+			{
+				switch ((index + thread_index) % 3)
+				{
+				case 0:
+					z.store(sh::make_shared<int>(index));
+					break;
+				case 1:
+					(void)z.exchange(sh::make_shared<int>(index));
+					break;
+				default:
+				{
+					const rcu_read_guard guard;
+					for (int read = 0; read < 4; ++read)
+					{
+						const int* const loaded = guard.load(z);
+						ASSERT_NE(loaded, nullptr);
+						ASSERT_GE(*loaded, 0);
+						ASSERT_LT(*loaded, iterations);
+					}
+					break;
+				}
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
@@ -0,0 +1,179 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/recycled_shared.hpp>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	template <int N>
+	struct envelope final
+	{
+		envelope() = default;
+		explicit envelope(const int value) noexcept
+			: m_value{ value }
+		{ }
+
+		int m_value{ 0 };
+		char m_payload[N];
+	};
+
+	/**	Releases a value within a thread_local's destructor.
+	 */
+	template <typename T>
+	struct release_at_exit final
+	{
+		~release_at_exit()
+		{
+			m_value.reset();
+		}
+		sh::shared_ptr<T> m_value;
+	};
+} // anonymous namespace
+
+TEST(sh_recycled_shared, reuse)
+{
+	using value_type = envelope<1>;
+	const sh::pointer::recycle_stats before = sh::recycled_shared_stats<value_type>();
+
+	sh::shared_ptr<value_type> x = sh::make_recycled_shared<value_type>(123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(123, x->m_value);
+	const value_type* const address = x.get();
+	x.reset();
+	EXPECT_EQ(before.m_depth + 1, sh::recycled_shared_stats<value_type>().m_depth);
+
+	x = sh::make_recycled_shared<value_type>(456);
+	EXPECT_EQ(address, x.get());
+	EXPECT_EQ(456, x->m_value);
+
+	const sh::pointer::recycle_stats after = sh::recycled_shared_stats<value_type>();
+	EXPECT_EQ(before.m_depth, after.m_depth);
+	EXPECT_EQ(before.m_misses + 1, after.m_misses);
+	EXPECT_EQ(before.m_hits + 1, after.m_hits);
+}
+TEST(sh_recycled_shared, weak_ptr)
+{
+	using value_type = envelope<2>;
+	sh::shared_ptr<value_type> x = sh::make_recycled_shared<value_type>();
+	const sh::weak_ptr<value_type> y = x;
+	const std::size_t depth = sh::recycled_shared_stats<value_type>().m_depth;
+	x.reset();
+	// The storage isn't recycled until the weak reference is released:
+	EXPECT_EQ(depth, sh::recycled_shared_stats<value_type>().m_depth);
+	EXPECT_TRUE(y.expired());
+}
+TEST(sh_recycled_shared, capacity)
+{
+	using value_type = envelope<3>;
+	const std::size_t count = sh::pointer::recycler<value_type>::capacity
+		+ sh::pointer::recycler<value_type>::thread_capacity + 10;
+	std::vector<sh::shared_ptr<value_type>> values;
+	for (std::size_t index = 0; index < count; ++index)
+	{
+		values.push_back(sh::make_recycled_shared<value_type>());
+	}
+	values.clear();
+	const sh::pointer::recycle_stats stats = sh::recycled_shared_stats<value_type>();
+	EXPECT_EQ(count - 10, stats.m_depth);
+	EXPECT_EQ(10u, stats.m_discards);
+}
+TEST(sh_recycled_shared, cross_thread)
+{
+	using value_type = envelope<4>;
+	std::vector<sh::shared_ptr<value_type>> values;
+	for (int index = 0; index < 10; ++index)
+	{
+		values.push_back(sh::make_recycled_shared<value_type>(index));
+	}
+	std::thread{ [&values]() { values.clear(); } }.join();
+	EXPECT_EQ(10u, sh::recycled_shared_stats<value_type>().m_depth);
+
+	const std::size_t hits = sh::recycled_shared_stats<value_type>().m_hits;
+	for (int index = 0; index < 10; ++index)
+	{
+		values.push_back(sh::make_recycled_shared<value_type>(index));
+	}
+	EXPECT_EQ(hits + 10, sh::recycled_shared_stats<value_type>().m_hits);
+}
+TEST(sh_recycled_shared, release_during_thread_exit)
+{
+	using value_type = envelope<6>;
+	const std::size_t depth = sh::recycled_shared_stats<value_type>().m_depth;
+	std::thread{ []()
+	{
+		// Constructed before the thread's free list, so destroyed after it:
+		thread_local release_at_exit<value_type> late;
+		late.m_value = sh::make_recycled_shared<value_type>(1);
+	} }.join();
+	EXPECT_EQ(depth + 1, sh::recycled_shared_stats<value_type>().m_depth);
+
+	// The block is held by the shared free list rather than the destroyed thread's:
+	const std::size_t hits = sh::recycled_shared_stats<value_type>().m_hits;
+	const sh::shared_ptr<value_type> x = sh::make_recycled_shared<value_type>(2);
+	EXPECT_EQ(hits + 1, sh::recycled_shared_stats<value_type>().m_hits);
+}
+TEST(sh_recycled_shared, concurrent)
+{
+	using value_type = envelope<5>;
+	constexpr int thread_count = 4;
+	constexpr int iterations = 10000;
+	std::vector<std::thread> threads;
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([thread_index]()
+		{
+			std::vector<sh::shared_ptr<value_type>> values;
+			for (int index = 0; index < iterations; ++index)
+			{
+				values.push_back(sh::make_recycled_shared<value_type>(thread_index));
+				if (values.size() > 8)
+				{
+					values.erase(values.begin(), values.begin() + 4);
+				}
+			}
+			for (const sh::shared_ptr<value_type>& value : values)
+			{
+				EXPECT_EQ(thread_index, value->m_value);
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	const sh::pointer::recycle_stats stats = sh::recycled_shared_stats<value_type>();
+	EXPECT_EQ(std::size_t{ thread_count * iterations }, stats.m_hits + stats.m_misses);
+	EXPECT_LE(stats.m_depth, sh::pointer::recycler<value_type>::capacity);
+}
@@ -0,0 +1,212 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/atomic_shared_ptr.hpp>
+#include <sh/sharded_shared.hpp>
+#include <sh/shared_ptr.hpp>
+#include <sh/wide_shared_ptr.hpp>
+#include <atomic>
+#include <latch>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct destruct_counter final
+	{
+		explicit destruct_counter(std::atomic<int>& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_counter()
+		{
+			m_destructed.fetch_add(1);
+		}
+		std::atomic<int>& m_destructed;
+	};
+} // anonymous namespace
+
+TEST(sh_sharded_shared, make_sharded_shared)
+{
+	const sh::shared_ptr<int> x = sh::make_sharded_shared<int>(123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(*x, 123);
+	EXPECT_EQ(x.use_count(), 1u);
+	{
+		const sh::shared_ptr<int> y = x;
+		EXPECT_EQ(x.use_count(), 2u);
+		const sh::shared_ptr<const int> z = y;
+		EXPECT_EQ(x.use_count(), 3u);
+	}
+	EXPECT_EQ(x.use_count(), 1u);
+}
+TEST(sh_sharded_shared, allocate_sharded_shared)
+{
+	const sh::shared_ptr<int> x = sh::allocate_sharded_shared<int>(std::allocator<int>{}, 123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_EQ(*x, 123);
+	EXPECT_EQ(x.use_count(), 1u);
+}
+TEST(sh_sharded_shared, destruct)
+{
+	std::atomic<int> destructed{ 0 };
+	{
+		sh::shared_ptr<destruct_counter> x = sh::make_sharded_shared<destruct_counter>(destructed);
+		sh::shared_ptr<destruct_counter> y = x;
+		x.reset();
+		EXPECT_EQ(destructed, 0);
+		EXPECT_EQ(y.use_count(), 1u);
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_sharded_shared, destruct_last_copy)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::shared_ptr<destruct_counter> x = sh::make_sharded_shared<destruct_counter>(destructed);
+	std::vector<sh::shared_ptr<destruct_counter>> copies(10, x);
+	EXPECT_EQ(x.use_count(), 11u);
+	// The original reference is released before those copied from it:
+	x.reset();
+	copies.resize(1);
+	EXPECT_EQ(destructed, 0);
+	EXPECT_EQ(copies[0].use_count(), 1u);
+	copies.clear();
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_sharded_shared, weak_ptr)
+{
+	std::atomic<int> destructed{ 0 };
+	sh::shared_ptr<destruct_counter> x = sh::make_sharded_shared<destruct_counter>(destructed);
+	const sh::weak_ptr<destruct_counter> weak{ x };
+	EXPECT_FALSE(weak.expired());
+	EXPECT_EQ(weak.use_count(), 1u);
+	{
+		const sh::shared_ptr<destruct_counter> locked = weak.lock();
+		ASSERT_TRUE(bool(locked));
+		EXPECT_EQ(x.use_count(), 2u);
+	}
+	x.reset();
+	EXPECT_EQ(destructed, 1);
+	EXPECT_TRUE(weak.expired());
+	EXPECT_FALSE(bool(weak.lock()));
+}
+TEST(sh_sharded_shared, wide_and_atomic)
+{
+	std::atomic<int> destructed{ 0 };
+	{
+		sh::shared_ptr<destruct_counter> x = sh::make_sharded_shared<destruct_counter>(destructed);
+		{
+			const sh::wide_shared_ptr<destruct_counter> wide{ x };
+			const sh::wide_weak_ptr<destruct_counter> weak{ wide };
+			EXPECT_EQ(wide.use_count(), 2u);
+			EXPECT_TRUE(bool(weak.lock()));
+		}
+		std::atomic<sh::shared_ptr<destruct_counter>> atomic{ x };
+		for (int i = 0; i < 100; ++i)
+		{
+			const sh::shared_ptr<destruct_counter> loaded = atomic.load();
+			EXPECT_EQ(loaded, x);
+		}
+		x.reset();
+		EXPECT_EQ(destructed, 0);
+		atomic.store(nullptr);
+		EXPECT_EQ(destructed, 1);
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_sharded_shared, threads)
+{
+	constexpr int thread_count{ 8 };
+	std::atomic<int> destructed{ 0 };
+	sh::shared_ptr<destruct_counter> x = sh::make_sharded_shared<destruct_counter>(destructed);
+	std::vector<std::thread> threads;
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		threads.emplace_back([source = x]()
+		{
+			for (int i = 0; i < 10'000; ++i)
+			{
+				sh::shared_ptr<destruct_counter> copy = source;
+				const sh::weak_ptr<destruct_counter> weak{ copy };
+				copy.reset();
+				copy = weak.lock();
+				ASSERT_TRUE(bool(copy));
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	EXPECT_EQ(destructed, 0);
+	EXPECT_EQ(x.use_count(), 1u);
+	x.reset();
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_sharded_shared, release_across_threads)
+{
+	// References taken by one thread & released by others, racing to release the last:
+	constexpr int thread_count{ 4 };
+	constexpr int copies_per_thread{ 1000 };
+	for (int trial = 0; trial < 20; ++trial)
+	{
+		std::atomic<int> destructed{ 0 };
+		std::vector<std::vector<sh::shared_ptr<destruct_counter>>> copies(thread_count);
+		{
+			const sh::shared_ptr<destruct_counter> x = sh::make_sharded_shared<destruct_counter>(destructed);
+			for (auto& each : copies)
+			{
+				each.assign(copies_per_thread, x);
+			}
+		}
+		std::latch start{ thread_count };
+		std::vector<std::thread> threads;
+		for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+		{
+			threads.emplace_back([&start, &mine = copies[thread_index]]()
+			{
+				start.arrive_and_wait();
+				while (mine.empty() == false)
+				{
+					sh::shared_ptr<destruct_counter> copy = mine.back();
+					mine.pop_back();
+					copy.reset();
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		EXPECT_EQ(destructed, 1);
+	}
+}
@@ -0,0 +1,149 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/shared_arena.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct destruct_counter final
+	{
+		explicit destruct_counter(int& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_counter()
+		{
+			++m_destructed;
+		}
+		int& m_destructed;
+	};
+
+	struct alignas(sh::pointer::max_alignment * 4) extended_alignment
+	{
+		int m_value;
+	};
+} // anonymous namespace
+
+TEST(sh_shared_arena, make_arena_shared)
+{
+	const sh::shared_arena arena;
+	EXPECT_EQ(1u, arena.use_count());
+	EXPECT_EQ(0u, arena.bytes_reserved());
+	{
+		const sh::shared_ptr<int> x = sh::make_arena_shared<int>(arena, 123);
+		ASSERT_TRUE(bool(x));
+		EXPECT_EQ(123, *x);
+		EXPECT_EQ(2u, arena.use_count());
+		EXPECT_EQ(std::size_t{ SH_POINTER_ARENA_CHUNK_SIZE }, arena.bytes_reserved());
+
+		const sh::shared_ptr<int> y = sh::make_arena_shared<int>(arena, 456);
+		EXPECT_EQ(3u, arena.use_count());
+		EXPECT_NE(x.get(), y.get());
+	}
+	EXPECT_EQ(1u, arena.use_count());
+	// Monotonic, so memory isn't returned until the arena is released:
+	EXPECT_EQ(std::size_t{ SH_POINTER_ARENA_CHUNK_SIZE }, arena.bytes_reserved());
+}
+TEST(sh_shared_arena, outlives_handle)
+{
+	int destructed{ 0 };
+	sh::shared_ptr<destruct_counter> x;
+	sh::weak_ptr<destruct_counter> y;
+	{
+		const sh::shared_arena arena;
+		x = sh::make_arena_shared<destruct_counter>(arena, destructed);
+		y = x;
+	}
+	EXPECT_EQ(0, destructed);
+	EXPECT_EQ(x.get(), y.lock().get());
+	x.reset();
+	EXPECT_EQ(1, destructed);
+	// The weak reference keeps the control block & so the arena alive:
+	EXPECT_EQ(nullptr, y.lock().get());
+	y.reset();
+}
+TEST(sh_shared_arena, allocate_shared_array)
+{
+	const sh::shared_arena arena{ 256 };
+	const sh::shared_ptr<int[]> x = sh::allocate_shared<int[]>(arena.get_allocator<int>(), 100, 7);
+	for (int index = 0; index < 100; ++index)
+	{
+		EXPECT_EQ(7, x[index]);
+	}
+	const sh::shared_ptr<int[4]> y = sh::allocate_shared<int[4]>(arena.get_allocator<int>());
+	EXPECT_EQ(3u, arena.use_count());
+	// The first request exceeds the chunk size & so reserves a chunk of its own:
+	EXPECT_GT(arena.bytes_reserved(), 100 * sizeof(int));
+}
+TEST(sh_shared_arena, extended_alignment)
+{
+	const sh::shared_arena arena;
+	for (int index = 0; index < 16; ++index)
+	{
+		const sh::shared_ptr<char> pad = sh::make_arena_shared<char>(arena);
+		const sh::shared_ptr<extended_alignment> x = sh::make_arena_shared<extended_alignment>(arena, extended_alignment{ index });
+		EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(x.get()) % alignof(extended_alignment));
+		EXPECT_EQ(index, x->m_value);
+	}
+}
+TEST(sh_shared_arena, release_from_other_thread)
+{
+	int destructed{ 0 };
+	std::vector<sh::shared_ptr<destruct_counter>> values;
+	{
+		const sh::shared_arena arena{ 128 };
+		for (int index = 0; index < 100; ++index)
+		{
+			values.push_back(sh::make_arena_shared<destruct_counter>(arena, destructed));
+		}
+		EXPECT_EQ(101u, arena.use_count());
+	}
+	std::thread{ [&values]() { values.clear(); } }.join();
+	EXPECT_EQ(100, destructed);
+}
+TEST(sh_shared_arena, copy)
+{
+	sh::shared_arena arena;
+	const sh::shared_ptr<int> x = sh::make_arena_shared<int>(arena, 1);
+	{
+		const sh::shared_arena copy = arena;
+		EXPECT_EQ(3u, arena.use_count());
+		EXPECT_TRUE(arena.get_allocator<int>() == copy.get_allocator<long>());
+	}
+	const sh::shared_arena other;
+	EXPECT_FALSE(arena.get_allocator<int>() == other.get_allocator<int>());
+	arena = other;
+	EXPECT_EQ(2u, other.use_count());
+}
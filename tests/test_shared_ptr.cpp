@@ -31,9 +31,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <iterator>
 #include <sh/shared_ptr.hpp>
+#include <string>
+#include <vector>
 
 using sh::const_pointer_cast;
 using sh::dynamic_pointer_cast;
@@ -288,6 +292,19 @@ namespace
 	int throws_on_counter::throw_counter = -1;
 	int throws_on_counter::current_counter = 0;
 
+	struct alignas(sh::pointer::max_alignment * 4) extended_alignment
+	{
+		int m_value;
+	};
+	struct alignas(sh::pointer::max_alignment * 4) extended_throws_on_counter : throws_on_counter
+	{ };
+
+	template <typename T>
+	bool is_aligned(const T* const value) noexcept
+	{
+		return reinterpret_cast<std::uintptr_t>(value) % alignof(T) == 0;
+	}
+
 	class sh_shared_ptr : public ::testing::Test
 	{
 	protected:
@@ -1253,6 +1270,46 @@ TEST_F(sh_shared_ptr, allocate_shared_for_overwrite_throw)
 	throws_on_counter::current_counter = 0;
 	EXPECT_THROW(sh::allocate_shared_for_overwrite<throws_on_counter>(counted_allocator<throws_on_counter>{}), configurable_exception);
 }
+TEST_F(sh_shared_ptr, make_shared_extended_alignment)
+{
+	shared_ptr<extended_alignment> x = make_shared<extended_alignment>(123);
+	ASSERT_TRUE(bool(x));
+	EXPECT_TRUE(is_aligned(x.get()));
+	EXPECT_EQ(123, x->m_value);
+	EXPECT_EQ(1u, x.use_count());
+
+	shared_ptr<const extended_alignment> y = x;
+	EXPECT_EQ(2u, x.use_count());
+	weak_ptr<extended_alignment> z{ x };
+	EXPECT_EQ(x.get(), z.lock().get());
+
+	x.reset();
+	y.reset();
+	EXPECT_EQ(nullptr, z.lock().get());
+
+	x = sh::make_shared_for_overwrite<extended_alignment>();
+	EXPECT_TRUE(is_aligned(x.get()));
+}
+TEST_F(sh_shared_ptr, allocate_shared_extended_alignment)
+{
+	counted_allocator<extended_alignment> alloc;
+	std::vector<shared_ptr<extended_alignment>> values;
+	for (int index = 0; index < 8; ++index)
+	{
+		values.push_back(sh::allocate_shared<extended_alignment>(alloc, index));
+		EXPECT_TRUE(is_aligned(values.back().get()));
+		EXPECT_EQ(index, values.back()->m_value);
+	}
+	EXPECT_EQ(8u, general_allocations::get().m_allocate_calls);
+	values.clear();
+	EXPECT_EQ(0u, general_allocations::get().m_current);
+}
+TEST_F(sh_shared_ptr, allocate_shared_extended_alignment_throw)
+{
+	throws_on_counter::throw_counter = 0;
+	throws_on_counter::current_counter = 0;
+	EXPECT_THROW(sh::allocate_shared<extended_throws_on_counter>(counted_allocator<extended_throws_on_counter>{}), configurable_exception);
+}
 TEST_F(sh_shared_ptr, allocate_shared_for_overwrite_array)
 {
 	constexpr char prefill = '\xff';
@@ -1291,6 +1348,137 @@ TEST_F(sh_shared_ptr, allocate_shared_for_overwrite_array_throw)
 	general_allocations::get().m_construct_default += 1;
 }
 
+TEST_F(sh_shared_ptr, make_shared_n)
+{
+	std::vector<shared_ptr<int>> x;
+	const auto end = sh::make_shared_n<int>(std::back_inserter(x), 100, 7);
+	(void)end;
+	ASSERT_EQ(100u, x.size());
+	for (std::size_t index = 0; index < x.size(); ++index)
+	{
+		ASSERT_TRUE(bool(x[index]));
+		EXPECT_EQ(7, *x[index]);
+		EXPECT_EQ(1u, x[index].use_count());
+		if (index > 0)
+		{
+			EXPECT_FALSE(x[index - 1].owner_before(x[index]) == false && x[index].owner_before(x[index - 1]) == false);
+		}
+	}
+	*x[3] = 123;
+	EXPECT_EQ(7, *x[4]);
+
+	shared_ptr<const int> y[2];
+	EXPECT_EQ(std::end(y), sh::make_shared_n<const int>(std::begin(y), 2));
+	EXPECT_EQ(0, *y[1]);
+	EXPECT_EQ(std::begin(y), sh::make_shared_n<const int>(std::begin(y), 0));
+}
+TEST_F(sh_shared_ptr, allocate_shared_n)
+{
+	using namespace SingleInheritance;
+	counted_allocator<Derived> alloc;
+	std::vector<shared_ptr<Base>> x;
+	sh::allocate_shared_n<Derived>(alloc, std::back_inserter(x), 10);
+	ASSERT_EQ(10u, x.size());
+	EXPECT_EQ(1u, general_allocations::get().m_allocate_calls);
+	EXPECT_EQ(10u, general_allocations::get().m_construct_calls);
+
+	// Released independently; the allocation remains until the last:
+	weak_ptr<Base> y{ x[5] };
+	x[5].reset();
+	EXPECT_TRUE(y.expired());
+	EXPECT_EQ(1u, general_allocations::get().m_destroy_calls);
+	x.erase(x.begin(), x.begin() + 9);
+	EXPECT_EQ(9u, general_allocations::get().m_destroy_calls);
+	EXPECT_EQ(0u, general_allocations::get().m_deallocate_calls);
+	x.clear();
+	EXPECT_EQ(10u, general_allocations::get().m_destroy_calls);
+	EXPECT_EQ(0u, general_allocations::get().m_deallocate_calls);
+	y.reset();
+	EXPECT_EQ(1u, general_allocations::get().m_deallocate_calls);
+}
+TEST_F(sh_shared_ptr, trivially_destructible_release)
+{
+	static_assert(sh::pointer::is_destroy_trivial_v<sh::pointer::default_allocator<int>, int>);
+	static_assert(sh::pointer::is_destroy_trivial_v<std::allocator<int>, int>);
+	static_assert(false == sh::pointer::is_destroy_trivial_v<sh::pointer::default_allocator<std::string>, std::string>);
+	// An allocator declaring destroy is still called, even for trivially destructible values:
+	static_assert(false == sh::pointer::is_destroy_trivial_v<counted_allocator<int>, int>);
+	{
+		const shared_ptr<int> x = sh::allocate_shared<int>(counted_allocator<int>{}, 123);
+		const shared_ptr<int[]> y = sh::allocate_shared<int[]>(counted_allocator<int>{}, 3);
+	}
+	EXPECT_EQ(general_allocations::get().m_construct_calls, general_allocations::get().m_destroy_calls);
+	EXPECT_EQ(2u, general_allocations::get().m_deallocate_calls);
+}
+TEST_F(sh_shared_ptr, shared_operations)
+{
+	static_assert(sh::pointer::is_rebind_agnostic_v<sh::pointer::default_allocator<int>>);
+	static_assert(sh::pointer::is_rebind_agnostic_v<std::allocator<int>>);
+	static_assert(false == sh::pointer::is_rebind_agnostic_v<counted_allocator<int>>);
+
+	struct alignas(float) four_bytes final
+	{
+		std::uint8_t m_bytes[4];
+	};
+	// Trivially destructible values of the same size & alignment may share control operations:
+	{
+		const shared_ptr<int> a = sh::make_shared<int>(1);
+		const shared_ptr<float> b = sh::make_shared<float>(2.0f);
+		const shared_ptr<four_bytes> c = sh::make_shared<four_bytes>(four_bytes{ { 3, 4, 5, 6 } });
+		const shared_ptr<int> d = sh::allocate_shared<int>(std::allocator<float>{}, 7);
+		const weak_ptr<float> e = b;
+		EXPECT_EQ(1, *a);
+		EXPECT_EQ(2.0f, *b);
+		EXPECT_EQ(6, c->m_bytes[3]);
+		EXPECT_EQ(7, *d);
+		EXPECT_EQ(b, e.lock());
+	}
+	// Values sharing operations with other types must still be released with their own allocator:
+	{
+		const shared_ptr<int> x = sh::allocate_shared<int>(counted_allocator<int>{}, 123);
+	}
+	EXPECT_EQ(1u, general_allocations::get().m_deallocate_calls);
+}
+TEST_F(sh_shared_ptr, allocate_shared_n_throw)
+{
+	std::vector<shared_ptr<throws_on_counter>> x;
+	const throws_on_counter init_value;
+	throws_on_counter::throw_counter = 3;
+	throws_on_counter::current_counter = 0;
+	EXPECT_THROW(sh::allocate_shared_n<throws_on_counter>(counted_allocator<throws_on_counter>{}, std::back_inserter(x), 5, init_value), configurable_exception);
+	EXPECT_TRUE(x.empty());
+}
+TEST_F(sh_shared_ptr, allocate_shared_n_output_throw)
+{
+	struct throwing_output final
+	{
+		throwing_output& operator*() noexcept
+		{
+			return *this;
+		}
+		throwing_output& operator=(shared_ptr<int> value)
+		{
+			if (m_values->size() == 3)
+			{
+				throw configurable_exception{};
+			}
+			m_values->push_back(std::move(value));
+			return *this;
+		}
+		throwing_output& operator++() noexcept
+		{
+			return *this;
+		}
+
+		std::vector<shared_ptr<int>>* m_values;
+	};
+	std::vector<shared_ptr<int>> x;
+	EXPECT_THROW(sh::allocate_shared_n<int>(counted_allocator<int>{}, throwing_output{ &x }, 5), configurable_exception);
+	ASSERT_EQ(3u, x.size());
+	EXPECT_EQ(0u, general_allocations::get().m_deallocate_calls);
+	x.clear();
+	EXPECT_EQ(1u, general_allocations::get().m_deallocate_calls);
+}
 TEST_F(sh_shared_ptr, shared_ptr_const_cast)
 {
 	const shared_ptr<int> x{ make_shared<int>(123) };
@@ -0,0 +1,167 @@
+/*	BSD 3-Clause License
+
+	Copyright (c) 2025, Paul Varga
+	All rights reserved.
+
+	Redistribution and use in source and binary forms, with or without
+	modification, are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its
+	   contributors may be used to endorse or promote products derived from
+	   this software without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+	IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+	OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <sh/atomic_shared_ptr.hpp>
+#include <sh/local_shared_ptr.hpp>
+#include <sh/shared_ptr.hpp>
+#include <sh/wide_shared_ptr.hpp>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct destruct_counter : sh::weak_free
+	{
+		explicit destruct_counter(int& destructed) noexcept
+			: m_destructed{ destructed }
+		{ }
+		~destruct_counter()
+		{
+			++m_destructed;
+		}
+		int& m_destructed;
+	};
+	struct derived_counter final : destruct_counter
+	{
+		using destruct_counter::destruct_counter;
+	};
+	struct value final : sh::weak_free
+	{
+		int m_value{ 123 };
+	};
+} // anonymous namespace
+
+TEST(sh_weak_free, is_weak_free)
+{
+	static_assert(sh::pointer::is_weak_free_v<destruct_counter>);
+	static_assert(sh::pointer::is_weak_free_v<derived_counter>);
+	static_assert(sh::pointer::is_weak_free_v<const value>);
+	static_assert(false == sh::pointer::is_weak_free_v<int>);
+	static_assert(false == sh::pointer::is_weak_free_v<void>);
+	static_assert(sizeof(sh::shared_ptr<value>) == sizeof(void*));
+}
+TEST(sh_weak_free, make_shared)
+{
+	int destructed{ 0 };
+	{
+		sh::shared_ptr<destruct_counter> x = sh::make_shared<destruct_counter>(destructed);
+		EXPECT_EQ(x.use_count(), 1u);
+		sh::shared_ptr<destruct_counter> y = x;
+		EXPECT_EQ(x.use_count(), 2u);
+		const sh::shared_ptr<const destruct_counter> z = std::move(y);
+		EXPECT_EQ(x.use_count(), 2u);
+		x.reset();
+		EXPECT_EQ(destructed, 0);
+		EXPECT_EQ(z.use_count(), 1u);
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_weak_free, derived)
+{
+	int destructed{ 0 };
+	{
+		sh::shared_ptr<derived_counter> x = sh::make_shared<derived_counter>(destructed);
+		sh::shared_ptr<destruct_counter> y = x;
+		x.reset();
+		EXPECT_EQ(destructed, 0);
+		EXPECT_EQ(y.use_count(), 1u);
+		x = sh::static_pointer_cast<derived_counter>(y);
+		y.reset();
+		EXPECT_EQ(destructed, 0);
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_weak_free, array)
+{
+	const sh::shared_ptr<value[]> x = sh::make_shared<value[]>(3);
+	sh::shared_ptr<value[]> y = x;
+	EXPECT_EQ(x.use_count(), 2u);
+	EXPECT_EQ(y[2].m_value, 123);
+	y.reset();
+	EXPECT_EQ(x.use_count(), 1u);
+}
+TEST(sh_weak_free, wide_local_and_atomic)
+{
+	int destructed{ 0 };
+	{
+		const sh::shared_ptr<destruct_counter> x = sh::make_shared<destruct_counter>(destructed);
+		{
+			const sh::wide_shared_ptr<destruct_counter> wide{ x };
+			EXPECT_EQ(x.use_count(), 2u);
+			const sh::shared_ptr<destruct_counter> collapsed = wide.collapse();
+			EXPECT_EQ(collapsed.get(), x.get());
+			EXPECT_EQ(x.use_count(), 3u);
+		}
+		std::atomic<sh::shared_ptr<destruct_counter>> atomic{ x };
+		EXPECT_EQ(atomic.load().get(), x.get());
+		EXPECT_EQ(x.use_count(), 2u);
+		atomic.store(sh::shared_ptr<destruct_counter>{});
+		EXPECT_EQ(x.use_count(), 1u);
+
+		const sh::local_shared_ptr<value> local = sh::make_local_shared<value>();
+		const sh::local_shared_ptr<value> local_copy = local;
+		EXPECT_EQ(local_copy->m_value, 123);
+		EXPECT_EQ(local.use_count(), 2u);
+	}
+	EXPECT_EQ(destructed, 1);
+}
+TEST(sh_weak_free, threads)
+{
+	int destructed{ 0 };
+	{
+		const sh::shared_ptr<destruct_counter> x = sh::make_shared<destruct_counter>(destructed);
+		std::vector<std::thread> threads;
+		for (int thread_index = 0; thread_index < 4; ++thread_index)
+		{
+			threads.emplace_back([&x]()
+			{
+				std::vector<sh::shared_ptr<destruct_counter>> copies;
+				for (int i = 0; i < 10'000; ++i)
+				{
+					copies.push_back(x);
+					if (copies.size() == 16)
+					{
+						copies.clear();
+					}
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		EXPECT_EQ(x.use_count(), 1u);
+		EXPECT_EQ(destructed, 0);
+	}
+	EXPECT_EQ(destructed, 1);
+}